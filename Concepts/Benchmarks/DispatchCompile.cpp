@@ -0,0 +1,142 @@
+// Compile-time cost of picking one of eight ranked fast paths plus a
+// fallback for 300 distinct types. DISPATCH_STYLE selects how the choice is
+// written:
+//
+//   0  an enable_if overload per path, each guard excluding the paths above it
+//   1  dispatch::call<...>(value)
+//   2  dispatch::first_t<...>{ }(value)
+//
+// The program does nothing when run; time the compiler instead:
+//
+//   time g++ -std=c++17 -fsyntax-only -DDISPATCH_STYLE=0 -I.. DispatchCompile.cpp
+//   time g++ -std=c++17 -fsyntax-only -DDISPATCH_STYLE=1 -I.. DispatchCompile.cpp
+//   time g++ -std=c++17 -fsyntax-only -DDISPATCH_STYLE=2 -I.. DispatchCompile.cpp
+//   cl /std:c++17 /Zs /DDISPATCH_STYLE=1 /I.. DispatchCompile.cpp
+//
+// Every style is checked against the same expected selection, so a faster
+// line is never faster because it picked a different path.
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "Concepts/Dispatch.hpp"
+
+#if !defined(DISPATCH_STYLE)
+#define DISPATCH_STYLE 1
+#endif
+
+namespace
+{
+
+  constexpr std::size_t types = 300;
+
+  template<std::size_t N>
+  struct item
+  {
+    static constexpr std::size_t value = N;
+  };
+
+  // Ranked conditions; when several hold for a type, the first one wins.
+  template<class T> constexpr bool path0 = T::value % 41 == 0;
+  template<class T> constexpr bool path1 = T::value % 37 == 0;
+  template<class T> constexpr bool path2 = T::value % 29 == 0;
+  template<class T> constexpr bool path3 = T::value % 23 == 0;
+  template<class T> constexpr bool path4 = T::value % 13 == 0;
+  template<class T> constexpr bool path5 = T::value % 7 == 0;
+  template<class T> constexpr bool path6 = T::value % 3 == 0;
+  template<class T> constexpr bool path7 = T::value % 2 == 0;
+
+  template<std::size_t Path>
+  struct impl
+  {
+    template<class T>
+    constexpr std::size_t operator ()(T) const { return Path * 1000 + T::value; }
+  };
+
+  constexpr std::size_t expected_path(std::size_t n)
+  {
+    constexpr std::size_t divisors[] = { 41, 37, 29, 23, 13, 7, 3, 2 };
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+      if (n % divisors[i] == 0)
+        return i;
+    }
+    return 8;
+  }
+
+#if DISPATCH_STYLE == 0
+  template<class T, std::enable_if_t<path0<T>, int> = 0>
+  constexpr std::size_t select(T t) { return impl<0>{ }(t); }
+
+  template<class T, std::enable_if_t<!path0<T> && path1<T>, int> = 0>
+  constexpr std::size_t select(T t) { return impl<1>{ }(t); }
+
+  template<class T, std::enable_if_t<!path0<T> && !path1<T> && path2<T>, int> = 0>
+  constexpr std::size_t select(T t) { return impl<2>{ }(t); }
+
+  template<class T, std::enable_if_t<!path0<T> && !path1<T> && !path2<T> && path3<T>, int> = 0>
+  constexpr std::size_t select(T t) { return impl<3>{ }(t); }
+
+  template<class T, std::enable_if_t<!path0<T> && !path1<T> && !path2<T> && !path3<T> && path4<T>, int> = 0>
+  constexpr std::size_t select(T t) { return impl<4>{ }(t); }
+
+  template<class T, std::enable_if_t<!path0<T> && !path1<T> && !path2<T> && !path3<T> && !path4<T> && path5<T>, int> = 0>
+  constexpr std::size_t select(T t) { return impl<5>{ }(t); }
+
+  template<class T, std::enable_if_t<!path0<T> && !path1<T> && !path2<T> && !path3<T> && !path4<T> && !path5<T> && path6<T>, int> = 0>
+  constexpr std::size_t select(T t) { return impl<6>{ }(t); }
+
+  template<class T, std::enable_if_t<!path0<T> && !path1<T> && !path2<T> && !path3<T> && !path4<T> && !path5<T> && !path6<T> && path7<T>, int> = 0>
+  constexpr std::size_t select(T t) { return impl<7>{ }(t); }
+
+  template<class T, std::enable_if_t<!path0<T> && !path1<T> && !path2<T> && !path3<T> && !path4<T> && !path5<T> && !path6<T> && !path7<T>, int> = 0>
+  constexpr std::size_t select(T t) { return impl<8>{ }(t); }
+#elif DISPATCH_STYLE == 1
+  template<class T>
+  constexpr std::size_t select(T t)
+  {
+    return dispatch::call<
+      dispatch::when<path0<T>, impl<0>>,
+      dispatch::when<path1<T>, impl<1>>,
+      dispatch::when<path2<T>, impl<2>>,
+      dispatch::when<path3<T>, impl<3>>,
+      dispatch::when<path4<T>, impl<4>>,
+      dispatch::when<path5<T>, impl<5>>,
+      dispatch::when<path6<T>, impl<6>>,
+      dispatch::when<path7<T>, impl<7>>,
+      dispatch::otherwise<impl<8>>
+    >(t);
+  }
+#else
+  template<class T>
+  constexpr std::size_t select(T t)
+  {
+    return dispatch::first_t<
+      dispatch::when<path0<T>, impl<0>>,
+      dispatch::when<path1<T>, impl<1>>,
+      dispatch::when<path2<T>, impl<2>>,
+      dispatch::when<path3<T>, impl<3>>,
+      dispatch::when<path4<T>, impl<4>>,
+      dispatch::when<path5<T>, impl<5>>,
+      dispatch::when<path6<T>, impl<6>>,
+      dispatch::when<path7<T>, impl<7>>,
+      dispatch::otherwise<impl<8>>
+    >{ }(t);
+  }
+#endif
+
+  template<std::size_t ...N>
+  constexpr bool all_selected(std::index_sequence<N...>)
+  {
+    return ((select(item<N>{ }) == expected_path(N) * 1000 + N) && ...);
+  }
+
+  static_assert(all_selected(std::make_index_sequence<types>{ }), "a type took the wrong path");
+
+}
+
+int main()
+{
+  return 0;
+}
@@ -0,0 +1,105 @@
+// sorting::sort against std::sort on records that are expensive to move.
+// Each record carries a 64-bit key and a 2 KB payload, so std::sort spends
+// its time moving payloads while the indirect sort moves each record once.
+// A small trivially movable type is included to show sorting::sort falling
+// back to std::sort when indirection does not pay.
+//
+//   g++ -std=c++17 -O2 -I.. IndirectSort.cpp -o indirect_sort
+//   cl /std:c++17 /O2 /EHsc /I.. IndirectSort.cpp
+//
+//   indirect_sort [records]
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "Bench.hpp"
+#include "Concepts/Sort.hpp"
+
+namespace
+{
+
+  constexpr int reps = 5;
+
+  struct record
+  {
+    std::uint64_t key;
+    char payload[2048];
+  };
+
+  static_assert(sorting::PreferIndirect<record>, "the benchmark record should take the indirect path");
+  static_assert(!sorting::PreferIndirect<std::uint64_t>, "plain keys should take the direct path");
+
+  template<class T, class Check, class Sort>
+  double time_sort(const std::vector<T> &input, Check &&check, Sort &&sort)
+  {
+    std::vector<T> work;
+    return bench::best_of(reps, [&]
+    {
+      work = input;
+      sort(work);
+      check(work);
+    });
+  }
+
+  template<class T, class Key>
+  void require_sorted(const std::vector<T> &values, Key &&key)
+  {
+    for (std::size_t i = 1; i < values.size(); ++i)
+    {
+      if (key(values[i]) < key(values[i - 1]))
+      {
+        std::printf("not sorted at %zu\n", i);
+        std::exit(1);
+      }
+    }
+  }
+
+}
+
+int main(int argc, char **argv)
+{
+  const std::size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 20000;
+
+  std::mt19937_64 rng(42);
+  std::vector<record> records(count);
+  for (auto &r : records)
+  {
+    r.key = rng();
+    r.payload[0] = static_cast<char>(r.key);
+  }
+
+  std::vector<std::uint64_t> keys(count);
+  for (auto &k : keys)
+    k = rng();
+
+  const auto record_key = [](const record &r) { return r.key; };
+  const auto check_records = [&](const std::vector<record> &v) { require_sorted(v, record_key); };
+  const auto check_keys = [](const std::vector<std::uint64_t> &v) { require_sorted(v, [](std::uint64_t k) { return k; }); };
+
+  // Every timed run starts by copying the input; the first line is that copy alone.
+  bench::report("copy only, 2 KB records", 1e3 * time_sort(records, [](const std::vector<record> &) { }, [](std::vector<record> &) { }), "ms");
+  bench::report("std::sort, 2 KB records", 1e3 * time_sort(records, check_records, [](std::vector<record> &v)
+  {
+    std::sort(v.begin(), v.end(), [](const record &a, const record &b) { return a.key < b.key; });
+  }), "ms");
+  bench::report("sorting::sort, 2 KB records", 1e3 * time_sort(records, check_records, [](std::vector<record> &v)
+  {
+    sorting::sort(v.begin(), v.end(), std::less<>{ }, &record::key);
+  }), "ms");
+
+  bench::report("std::sort, uint64 keys", 1e3 * time_sort(keys, check_keys, [](std::vector<std::uint64_t> &v)
+  {
+    std::sort(v.begin(), v.end());
+  }), "ms");
+  bench::report("sorting::sort, uint64 keys", 1e3 * time_sort(keys, check_keys, [](std::vector<std::uint64_t> &v)
+  {
+    sorting::sort(v.begin(), v.end());
+  }), "ms");
+
+  return 0;
+}
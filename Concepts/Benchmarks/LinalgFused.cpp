@@ -0,0 +1,107 @@
+// linalg expressions and products against the loops they are meant to replace.
+// The fused expression r = 2a + b - c is timed against the same arithmetic
+// written as one hand loop. The blocked matrix product is timed against a
+// naive i-j-p triple loop. Each pair is checked for identical results before
+// any timing is reported.
+//
+//   g++ -std=c++17 -O2 -march=native -I.. LinalgFused.cpp -o linalg_fused
+//   cl /std:c++17 /O2 /arch:AVX2 /EHsc /I.. LinalgFused.cpp
+//
+//   linalg_fused [elements] [matrix size]
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "Bench.hpp"
+#include "Concepts/Linalg.hpp"
+
+namespace
+{
+
+  constexpr int reps = 7;
+
+  BENCH_NOINLINE void fused_linalg(linalg::vector<double> &r, const linalg::vector<double> &a, const linalg::vector<double> &b, const linalg::vector<double> &c)
+  {
+    r = 2.0 * a + b - c;
+  }
+
+  BENCH_NOINLINE void fused_hand(double *r, const double *a, const double *b, const double *c, std::size_t n)
+  {
+    for (std::size_t i = 0; i < n; ++i)
+      r[i] = 2.0 * a[i] + b[i] - c[i];
+  }
+
+  BENCH_NOINLINE void gemm_naive(const double *a, const double *b, double *c, std::size_t n)
+  {
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      for (std::size_t j = 0; j < n; ++j)
+      {
+        double sum = 0;
+        for (std::size_t p = 0; p < n; ++p)
+          sum += a[i * n + p] * b[p * n + j];
+        c[i * n + j] = sum;
+      }
+    }
+  }
+
+  template<class V>
+  void fill(V &v, std::size_t count, std::size_t seed)
+  {
+    for (std::size_t i = 0; i < count; ++i)
+      v[i] = static_cast<double>((i * 7 + seed) % 11) - 5;
+  }
+
+}
+
+int main(int argc, char **argv)
+{
+  const std::size_t elements = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t(1) << 20;
+  const std::size_t n = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 512;
+
+  linalg::vector<double> a(elements), b(elements), c(elements), r(elements);
+  fill(a, elements, 1);
+  fill(b, elements, 2);
+  fill(c, elements, 3);
+  std::vector<double> hand(elements);
+
+  fused_linalg(r, a, b, c);
+  fused_hand(hand.data(), a.data(), b.data(), c.data(), elements);
+  for (std::size_t i = 0; i < elements; ++i)
+  {
+    if (r[i] != hand[i])
+    {
+      std::printf("fused expression differs from the hand loop at %zu\n", i);
+      return 1;
+    }
+  }
+
+  const double streamed = 4.0 * sizeof(double) * static_cast<double>(elements) / (1 << 30);
+  bench::report("hand loop r = 2a + b - c", streamed / bench::best_of(reps, [&] { fused_hand(hand.data(), a.data(), b.data(), c.data(), elements); }), "GB/s");
+  bench::report("linalg r = 2a + b - c", streamed / bench::best_of(reps, [&] { fused_linalg(r, a, b, c); }), "GB/s");
+
+  linalg::matrix<double> x(n, n), y(n, n), z;
+  fill(x, n * n, 4);
+  fill(y, n * n, 5);
+  std::vector<double> naive(n * n);
+
+  z = x * y;
+  gemm_naive(x.data(), y.data(), naive.data(), n);
+  for (std::size_t i = 0; i < n * n; ++i)
+  {
+    if (z[i] != naive[i])
+    {
+      std::printf("blocked product differs from the triple loop at %zu\n", i);
+      return 1;
+    }
+  }
+
+  const double flops = 2.0 * static_cast<double>(n) * static_cast<double>(n) * static_cast<double>(n) / 1e9;
+  bench::report("naive triple loop GEMM", flops / bench::best_of(3, [&] { gemm_naive(x.data(), y.data(), naive.data(), n); }), "GFLOP/s");
+  bench::report("linalg blocked GEMM", flops / bench::best_of(3, [&] { z = x * y; }), "GFLOP/s");
+
+  bench::keep(r[0] + hand[0] + z[0] + naive[0] != 0);
+  return 0;
+}
@@ -0,0 +1,79 @@
+// Context-switch latency of coro::task and the executors in Task.hpp, against
+// a std::function callback doing the same work.
+//
+//   g++ -std=c++20 -O2 -fcoroutines -pthread -I.. TaskSwitch.cpp -o task_switch
+//   cl /std:c++latest /O2 /EHsc /I.. TaskSwitch.cpp
+
+#include <functional>
+
+#include "Bench.hpp"
+#include "Concepts/Task.hpp"
+
+namespace
+{
+
+  constexpr int steps = 1000000;
+  constexpr int reps = 5;
+
+  coro::task<int> leaf(int i)
+  {
+    co_return i;
+  }
+
+  // Each step allocates a pooled frame, transfers into it and back.
+  coro::task<long long> await_chain(int n)
+  {
+    long long sum = 0;
+    for (int i = 0; i < n; ++i)
+      sum += co_await leaf(i);
+    co_return sum;
+  }
+
+  BENCH_NOINLINE void leaf_callback(int i, const std::function<void(int)> &done)
+  {
+    done(i);
+  }
+
+  long long callback_chain(int n)
+  {
+    long long sum = 0;
+    for (int i = 0; i < n; ++i)
+      leaf_callback(i, [&sum](int v) { sum += v; });
+    return sum;
+  }
+
+  template<class Executor>
+  coro::task<void> hop(Executor &executor, int n)
+  {
+    for (int i = 0; i < n; ++i)
+      co_await executor.schedule();
+  }
+
+}
+
+int main()
+{
+  const double ns = 1e9 / steps;
+
+  bench::report("await child task", ns * bench::best_of(reps, [] {
+    bench::keep(coro::sync_wait(await_chain(steps)));
+  }), "ns/step");
+
+  bench::report("std::function callback", ns * bench::best_of(reps, [] {
+    bench::keep(callback_chain(steps));
+  }), "ns/step");
+
+  bench::report("single_thread_executor hop", ns * bench::best_of(reps, [] {
+    coro::single_thread_executor executor;
+    coro::spawn(executor, hop(executor, steps));
+    executor.run();
+  }), "ns/step");
+
+  coro::thread_pool_executor pool(2);
+  const int pool_steps = steps / 10;
+  bench::report("thread_pool_executor hop", 1e9 / pool_steps * bench::best_of(reps, [&] {
+    coro::sync_wait(hop(pool, pool_steps));
+  }), "ns/step");
+
+  return 0;
+}
@@ -1,6 +1,26 @@
+#include <algorithm>
+#include <bitset>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <unordered_set>
+#include <vector>
 
+#include "Concepts/Bitwise.hpp"
 #include "Concepts/Concepts.hpp"
+#include "Concepts/Dispatch.hpp"
+#include "Concepts/Flags.hpp"
+#include "Concepts/Instrument.hpp"
+#include "Concepts/Linalg.hpp"
+#include "Concepts/Pool.hpp"
+#include "Concepts/Sort.hpp"
+#include "Concepts/Stream.hpp"
 
 struct copy_const_able
 {
@@ -26,12 +46,453 @@ struct predicate_type_with_args
   bool operator()(int, int) { return true; }
 };
 
+struct padded_type
+{
+  char c;
+  int i;
+};
+
+struct keyed_type
+{
+  int key;
+  int cached;
+  bool operator ==(const keyed_type &other) const { return key == other.key; }
+};
+
+namespace bitwise
+{
+  template<>
+  struct by_value<keyed_type>
+  {
+    static constexpr bool value = true;
+  };
+}
+
+struct dedup_record
+{
+  std::uint64_t id;
+  std::uint32_t a, b;
+  bool operator ==(const dedup_record &other) const { return id == other.id && a == other.a && b == other.b; }
+};
+
+struct awaiter_type
+{
+  bool await_ready() { return true; }
+  template<class Handle> void await_suspend(Handle) { }
+  int await_resume() { return 0; }
+};
+
+struct forwarding_type
+{
+  constexpr int operator ()(int &value) const { return value; }
+  constexpr int operator ()(int &&value) const { return -value; }
+};
+
+struct reference_type
+{
+  constexpr int& operator ()(int &value) const { return value; }
+};
+
 static_assert(CopyConstructable<copy_const_able>, "");
 static_assert(Invocable<invocable_type>, "");
 static_assert(Predicate<predicate_type>, "");
 static_assert(Predicate<predicate_type_with_args, int, int>, "");
+static_assert(Awaiter<awaiter_type, void*>, "");
+static_assert(!Awaiter<invocable_type, void*>, "");
+static_assert(BitwiseComparable<int>, "");
+static_assert(!BitwiseComparable<float>, "");
+static_assert(!BitwiseComparable<padded_type>, "");
+static_assert(bitwise::detail::byte_equality<int>, "");
+static_assert(BitwiseComparable<keyed_type> && !bitwise::detail::byte_equality<keyed_type>, "");
+static_assert(BitwiseComparable<dedup_record> && bitwise::detail::byte_equality<dedup_record>, "");
+static_assert(bitwise::detail::byte_ordered<unsigned char> && bitwise::detail::byte_ordered<std::byte>, "");
+static_assert(!bitwise::detail::byte_ordered<int> && !bitwise::detail::byte_ordered<signed char>, "");
+static_assert(RandomAccessIterator<int*>, "");
+static_assert(RandomAccessIterator<const int*>, "");
+static_assert(!RandomAccessIterator<int>, "");
+static_assert(Assignable<int&, int>, "");
+static_assert(!Assignable<int, int>, "");
+static_assert(Swappable<int[3]>, "");
+static_assert(Regular<int*>, "");
+
+static_assert(concepts::Same<dispatch::first_t<
+  dispatch::when<Pointer<int>, padded_type>,
+  dispatch::when<Integral<int>, predicate_type>,
+  dispatch::otherwise<invocable_type>
+>, predicate_type>, "");
+static_assert(!exists<dispatch::first_t, dispatch::when<false, predicate_type>>, "");
+
+constexpr int dispatched_lvalue(int value)
+{
+  dispatch::call<dispatch::otherwise<reference_type>>(value) = value * 2;
+  return dispatch::call<dispatch::when<false, padded_type>, dispatch::otherwise<forwarding_type>>(value);
+}
+
+static_assert(dispatch::call<dispatch::when<false, padded_type>, dispatch::otherwise<forwarding_type>>(3) == -3, "");
+static_assert(concepts::Same<decltype(dispatch::call<dispatch::otherwise<reference_type>>(std::declval<int&>())), int&>, "");
+static_assert(dispatched_lvalue(3) == 6, "");
+
+bool bitwise_dedup_matches()
+{
+  std::unordered_set<dedup_record, bitwise::hasher<dedup_record>, bitwise::equal_to<dedup_record>> seen;
+  for (std::uint64_t i = 0; i < 100; ++i)
+    seen.insert({ i % 40, static_cast<std::uint32_t>(i % 40) * 3, 7 });
+
+  const dedup_record first{ 0, 0, 7 }, copy = first, other{ 0, 1, 7 };
+  return seen.size() == 40 && seen.count(first) == 1 && seen.count(other) == 0 &&
+    bitwise::hash(first) == bitwise::hash(copy) && bitwise::equal(keyed_type{ 1, 2 }, keyed_type{ 1, 3 });
+}
+
+struct chunk_counter
+{
+  void operator ()(stream::chunk c)
+  {
+    bytes += c.size();
+    ++chunks;
+    for (std::byte b : c)
+      marks += b == std::byte('x');
+  }
+
+  std::uint64_t bytes = 0;
+  std::uint64_t chunks = 0;
+  std::uint64_t marks = 0;
+};
+
+constexpr stream::chunk empty_chunk{ };
+static_assert(empty_chunk.empty() && empty_chunk.size() == 0, "");
+static_assert(stream::reader_options{ }.chunk_size % stream::reader_options{ }.alignment == 0, "");
+static_assert(Invocable<chunk_counter&, stream::chunk>, "");
+static_assert(!Invocable<chunk_counter&, int>, "");
+static_assert(concepts::Same<decltype(stream::read_chunks(std::string(), std::declval<chunk_counter&>())), std::uint64_t>, "");
+
+// Writes `size` bytes, every seventh an 'x', and reads them back in 4 KB chunks.
+bool stream_reads(const std::string &path, std::size_t size, std::uint64_t chunks)
+{
+  {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    for (std::size_t i = 0; i < size; ++i)
+      out.put(i % 7 ? '.' : 'x');
+  }
+
+  chunk_counter counter;
+  const std::uint64_t total = stream::read_chunks(path, counter, { 4096, 512 });
+  return total == size && counter.bytes == size && counter.chunks == chunks && counter.marks == (size + 6) / 7;
+}
+
+bool stream_matches()
+{
+  const std::string path = "concepts_stream_check.tmp";
+  bool ok = stream_reads(path, 10000, 3) && stream_reads(path, 8192, 2) && stream_reads(path, 0, 0);
+
+  try
+  {
+    stream::read_chunks(path, [](stream::chunk) { }, { 4096, 3000 });
+    ok = false;
+  }
+  catch (const std::invalid_argument &) { }
+
+  ok = ok && stream_reads(path, 20000, 5);
+  std::uint64_t seen = 0;
+  try
+  {
+    stream::read_chunks(path, [&seen](stream::chunk c)
+    {
+      seen += c.size();
+      throw std::runtime_error("consumer failed");
+    }, { 4096, 512 });
+    ok = false;
+  }
+  catch (const std::runtime_error &) { }
+
+  std::remove(path.c_str());
+  try
+  {
+    stream::read_chunks(path, chunk_counter{ });
+    ok = false;
+  }
+  catch (const std::system_error &) { }
+
+  return ok && seen == 4096;
+}
+
+using latency_histogram = instrument::detail::histogram;
+static_assert(latency_histogram::bucket_of(0) == 0, "");
+static_assert(latency_histogram::bucket_of(15) == 15, "");
+static_assert(latency_histogram::bucket_of(16) == 16, "");
+static_assert(latency_histogram::bucket_floor(latency_histogram::bucket_of(1000)) <= 1000, "");
+static_assert(latency_histogram::bucket_floor(latency_histogram::bucket_of(1000) + 1) > 1000, "");
+static_assert(latency_histogram::bucket_of(~std::uint64_t(0)) == latency_histogram::bucket_count - 1, "");
+static_assert(latency_histogram::bucket_floor(latency_histogram::bucket_of(std::uint64_t(1) << 40)) == std::uint64_t(1) << 40, "");
+static_assert(Invocable<instrument::instrumented_fn<predicate_type_with_args>&, int, int>, "");
+static_assert(Invocable<instrument::instrumented_fn<bool (predicate_type_with_args::*)(int, int)>&, predicate_type_with_args&, int, int>, "");
+static_assert(Invocable<const instrument::instrumented_fn<std::uint64_t chunk_counter::*>&, const chunk_counter&>, "");
+static_assert(!Invocable<instrument::instrumented_fn<predicate_type_with_args>&, std::string>, "");
+static_assert(!Invocable<const instrument::instrumented_fn<predicate_type_with_args>&, int, int>, "");
+static_assert(concepts::Same<dispatch::first_t<
+  dispatch::when<Invocable<instrument::instrumented_fn<predicate_type_with_args>&, chunk_counter>, padded_type>,
+  dispatch::otherwise<predicate_type>
+>, predicate_type>, "");
+
+template<class F>
+using instrumented_t = decltype(instrument::instrumented(std::declval<F>(), ""));
+static_assert(exists<instrumented_t, predicate_type> && exists<instrumented_t, bool (*)(int)>, "");
+static_assert(!exists<instrumented_t, int> && !exists<instrumented_t, int*>, "");
+#if defined(CONCEPTS_DISABLE_INSTRUMENTATION)
+static_assert(concepts::Same<decltype(instrument::instrumented(predicate_type{ }, "")), predicate_type>, "");
+#else
+static_assert(concepts::Same<decltype(instrument::instrumented(predicate_type{ }, "")), instrument::instrumented_fn<predicate_type>>, "");
+#endif
+
+bool instrumented_report_matches()
+{
+  auto timed = instrument::instrumented(predicate_type_with_args{ }, "predicate");
+  predicate_type_with_args predicate;
+  auto member = instrument::instrumented(&predicate_type_with_args::operator (), "member predicate");
+  const bool called = timed(1, 2) && member(predicate, 1, 2) && member(predicate, 3, 4);
+
+  std::ostringstream report;
+  instrument::write_report(report);
+  const std::string text = report.str();
+#if defined(CONCEPTS_DISABLE_INSTRUMENTATION)
+  return called && text.find('\n') + 1 == text.size();
+#else
+  return called && text.find("\npredicate,1,") != std::string::npos && text.find("\nmember predicate,2,") != std::string::npos;
+#endif
+}
+
+constexpr linalg::vector<int, 4> lhs_vector{ 1, 2, 3, 4 };
+constexpr linalg::vector<int, 4> rhs_vector{ 4, 3, 2, 1 };
+constexpr linalg::vector<int, 4> fused_vector = 2 * lhs_vector + rhs_vector - lhs_vector;
+constexpr linalg::matrix<int, 2, 3> lhs_matrix{ 1, 2, 3, 4, 5, 6 };
+constexpr linalg::matrix<int, 3, 2> rhs_matrix{ 7, 8, 9, 10, 11, 12 };
+constexpr linalg::matrix<int, 2, 2> product_matrix = lhs_matrix * rhs_matrix;
+static_assert(fused_vector[0] == 5 && fused_vector[1] == 5 && fused_vector[2] == 5 && fused_vector[3] == 5, "");
+static_assert(linalg::dot(lhs_vector, rhs_vector) == 20, "");
+static_assert(linalg::dot(lhs_vector - rhs_vector, -lhs_vector) == -10, "");
+static_assert(product_matrix(0, 0) == 58 && product_matrix(0, 1) == 64 && product_matrix(1, 0) == 139 && product_matrix(1, 1) == 154, "");
+static_assert((lhs_matrix * linalg::vector<int, 3>{ 1, 1, 1 })[1] == 15, "");
+static_assert(alignof(linalg::vector<char, 2>) == 2 && alignof(linalg::vector<double, 8>) == linalg::simd_alignment, "");
+static_assert(concepts::Same<decltype(lhs_vector + 1.0 * rhs_vector)::value_type, double>, "");
+
+bool dynamic_linalg_matches()
+{
+  // Large enough that the blocked product crosses every tile edge.
+  const std::size_t m = 70, k = 300, n = 530;
+  linalg::matrix<double> a(m, k), b(k, n);
+  for (std::size_t i = 0; i < a.size(); ++i)
+    a[i] = static_cast<double>(i % 7) - 3;
+  for (std::size_t i = 0; i < b.size(); ++i)
+    b[i] = static_cast<double>(i % 5) - 2;
+
+  const linalg::matrix<double> c = a * b;
+  for (std::size_t i = 0; i < m; ++i)
+  {
+    for (std::size_t j = 0; j < n; ++j)
+    {
+      double sum = 0;
+      for (std::size_t p = 0; p < k; ++p)
+        sum += a(i, p) * b(p, j);
+      if (c(i, j) != sum)
+        return false;
+    }
+  }
+
+  linalg::vector<double> x{ 1, 2, 3 }, y{ 4, 5, 6 }, moved(3);
+  const linalg::vector<double> taken = std::move(moved);
+  moved = 2.0 * x + y - x;
+  return taken.size() == 3 && moved.size() == 3 && moved[0] == 5 && moved[2] == 9;
+}
+
+enum class flag_color { red, green, blue, count };
+enum class wide_flag : unsigned { first = 0, last = 99 };
+
+namespace flags
+{
+  template<>
+  struct enum_size<wide_flag>
+  {
+    static constexpr std::size_t value = 100;
+  };
+}
+
+constexpr flags::enum_set<flag_color> primary_colors{ flag_color::red, flag_color::blue };
+constexpr flags::enum_set<wide_flag> wide_ends{ wide_flag::first, wide_flag::last };
+static_assert(flags::words_for(64) == 1 && flags::words_for(65) == 2, "");
+static_assert(flags::enum_set<flag_color>::bits == 3 && flags::enum_set<wide_flag>::word_count == 2, "");
+static_assert(primary_colors.contains(flag_color::red) && !primary_colors.contains(flag_color::green), "");
+static_assert(wide_ends.contains(wide_flag::last) && !wide_ends.contains(static_cast<wide_flag>(64)), "");
+static_assert(flags::enum_set<flag_color>::all().contains(flag_color::green), "");
+static_assert(flags::enum_set<wide_flag>::all().contains(wide_flag::last), "");
+static_assert([] {
+  auto s = primary_colors;
+  s.flip(flag_color::green);
+  s.erase(flag_color::red);
+  return s.contains(flag_color::green) && !s.contains(flag_color::red) && s.contains(flag_color::blue);
+}(), "");
+static_assert(flags::enum_map<flag_color, int>::size() == 3, "");
+static_assert(concepts::Same<decltype(*primary_colors.begin()), flag_color>, "");
+
+constexpr std::size_t checked_bits = 300;
+
+template<class Bits>
+Bits pattern_bits(std::size_t step, std::size_t offset)
+{
+  Bits bits(checked_bits);
+  for (std::size_t i = offset; i < checked_bits; i += step)
+    bits.set(i);
+  return bits;
+}
+
+bool same_bits(const flags::bitset &bits, const std::bitset<checked_bits> &expected)
+{
+  if (bits.size() != checked_bits || bits.count() != expected.count() || bits.any() != expected.any())
+    return false;
+
+  std::size_t next = bits.find_first();
+  for (std::size_t i = 0; i < checked_bits; ++i)
+  {
+    if (bits.test(i) != expected.test(i))
+      return false;
+    if (expected.test(i))
+    {
+      if (next != i)
+        return false;
+      next = bits.find_next(i);
+    }
+  }
+  return next == flags::npos;
+}
+
+bool flags_match()
+{
+  using reference = std::bitset<checked_bits>;
+  const auto a = pattern_bits<flags::bitset>(3, 1), b = pattern_bits<flags::bitset>(5, 0);
+  const reference ra = [] { reference r; for (std::size_t i = 1; i < checked_bits; i += 3) r.set(i); return r; }();
+  const reference rb = [] { reference r; for (std::size_t i = 0; i < checked_bits; i += 5) r.set(i); return r; }();
+
+  flags::bitset andnot = a;
+  andnot.and_not(b);
+  flags::bitset flipped = a;
+  flipped.flip();
+
+  std::size_t visited = 0;
+  a.for_each_set([&](std::size_t idx) { visited += ra.test(idx); });
+
+  flags::bitset sparse(10);
+  sparse.set(3);
+
+  flags::enum_set<flag_color> colors = ~primary_colors | (primary_colors - flags::enum_set<flag_color>{ flag_color::red });
+  std::size_t color_sum = 0;
+  for (flag_color c : colors)
+    color_sum += static_cast<std::size_t>(c);
+
+  return same_bits(a, ra) && same_bits(a & b, ra & rb) && same_bits(a | b, ra | rb) && same_bits(a ^ b, ra ^ rb) &&
+    same_bits(andnot, ra & ~rb) && same_bits(flipped, ~ra) && visited == ra.count() &&
+    (a & b).subset_of(a) && !a.subset_of(b) && a.intersects(b) &&
+    sparse.find_next(flags::npos) == flags::npos && sparse.find_next(9) == flags::npos && sparse.find_next(2) == 3 &&
+    colors.size() == 2 && color_sum == 3 && colors.intersects(primary_colors) && !colors.subset_of(primary_colors);
+}
+
+struct large_record
+{
+  std::uint64_t key;
+  char payload[512];
+};
+
+struct throwing_move_type
+{
+  throwing_move_type(throwing_move_type &&) noexcept(false) { }
+  throwing_move_type& operator =(throwing_move_type &&) noexcept(false) { return *this; }
+};
+
+static_assert(sorting::PreferIndirect<large_record>, "");
+static_assert(sorting::PreferIndirect<throwing_move_type>, "");
+static_assert(!sorting::PreferIndirect<int> && !sorting::PreferIndirect<std::string>, "");
+static_assert(sorting::RandomAccessRange<large_record*>, "");
+static_assert(!sorting::RandomAccessRange<flags::enum_set<flag_color>::iterator>, "");
+static_assert(concepts::Same<sorting::detail::projected_t<large_record*, decltype(&large_record::key)>, std::uint64_t>, "");
+static_assert(sorting::detail::CacheableKey<std::uint64_t> && !sorting::detail::CacheableKey<std::string>, "");
+static_assert(sorting::identity{ }(7) == 7, "");
+
+bool sorting_matches()
+{
+  std::vector<large_record> records(300);
+  for (std::size_t i = 0; i < records.size(); ++i)
+  {
+    records[i].key = (i * 7919) % 100;
+    records[i].payload[0] = static_cast<char>(i);
+  }
+
+  auto expected = records;
+  std::stable_sort(expected.begin(), expected.end(), [](const large_record &a, const large_record &b) { return a.key < b.key; });
+  sorting::stable_sort(records.begin(), records.end(), std::less<>{ }, &large_record::key);
+  for (std::size_t i = 0; i < records.size(); ++i)
+  {
+    if (records[i].key != expected[i].key || records[i].payload[0] != expected[i].payload[0])
+      return false;
+  }
+
+  std::vector<std::string> words{ "pear", "fig", "apple", "kiwi" };
+  sorting::indirect_sort(words.begin(), words.end(), std::greater<>{ });
+  return words == std::vector<std::string>{ "pear", "kiwi", "fig", "apple" };
+}
+
+struct pooled_request
+{
+  std::vector<int> ids;
+  std::string body;
+};
+
+namespace pool
+{
+  template<>
+  struct recycle_traits<pooled_request>
+  {
+    static void reset(pooled_request &r)
+    {
+      r.ids.clear();
+      r.body.clear();
+    }
+  };
+}
+
+struct pooled_buffer
+{
+  void clear() { bytes.clear(); }
+  std::vector<char> bytes;
+};
+
+static_assert(exists<pool::detail::clear_hook, std::string> && !exists<pool::detail::reset_hook, std::string>, "");
+static_assert(exists<pool::detail::reset_hook, std::unique_ptr<int>>, "");
+static_assert(exists<pool::detail::clear_hook, pooled_buffer> && !exists<pool::detail::clear_hook, pooled_request>, "");
+static_assert(concepts::Same<pool::object_pool<pooled_request>::handle, std::unique_ptr<pooled_request, pool::object_pool<pooled_request>::recycler>>, "");
+static_assert(pool::object_pool<pooled_buffer>::batch_size * 2 == pool::object_pool<pooled_buffer>::local_capacity, "");
+
+bool pool_keeps_capacity()
+{
+  const int *ids = nullptr;
+  const char *bytes = nullptr;
+  {
+    auto request = pool::object_pool<pooled_request>::acquire();
+    request->ids.assign(64, 1);
+    ids = request->ids.data();
+
+    auto buffer = pool::object_pool<pooled_buffer, pooled_request>::acquire();
+    buffer->bytes.assign(256, 'x');
+    bytes = buffer->bytes.data();
+  }
+
+  auto request = pool::object_pool<pooled_request>::acquire();
+  auto buffer = pool::object_pool<pooled_buffer, pooled_request>::acquire();
+  return request->ids.empty() && request->ids.data() == ids && buffer->bytes.empty() && buffer->bytes.data() == bytes;
+}
+
+// Defined in Coroutines.cpp, which is compiled as C++20.
+bool coroutines_match();
 
+// Checks that need the heap, files, threads or algorithms that are not
+// constexpr in C++17 cannot be static_asserts; they run here instead.
 int main()
 {
-  return 0;
+  return coroutines_match() && bitwise_dedup_matches() && instrumented_report_matches() && stream_matches() && dynamic_linalg_matches() && flags_match() && sorting_matches() && pool_keeps_capacity() ? 0 : 1;
 }
\ No newline at end of file
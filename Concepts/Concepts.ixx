@@ -0,0 +1,107 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2019 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+// C++20 module interface for the whole library. Build it with /std:c++20 (or
+// -std=c++20 -fmodules-ts) and `import concepts;` instead of including the
+// headers; the headers themselves stay usable from C++17.
+//
+// Every standard and platform header is pulled into the global module
+// fragment so the library headers below only contribute their own
+// declarations. Configuration macros (CONCEPTS_DISABLE_INSTRUMENTATION and
+// friends) do not cross an import, so define them when building this unit.
+//
+// GCC 12 builds this unit, but an importer that instantiates templates using
+// std::unique_ptr or std::tuple internally fails inside <tuple>. That covers the
+// dynamic linalg::vector and linalg::matrix, e.g. `v + v` on a
+// linalg::vector<double>. The concepts, flags, bitwise, instrument and
+// fixed-size linalg templates import cleanly there; with GCC 12, include the
+// headers for everything else.
+
+module;
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__cpp_impl_coroutine)
+#include <coroutine>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+export module concepts;
+
+export
+{
+#include "Concepts/Concepts.hpp"
+#include "Concepts/Bitwise.hpp"
+#include "Concepts/Dispatch.hpp"
+#include "Concepts/Flags.hpp"
+#include "Concepts/Instrument.hpp"
+#include "Concepts/Linalg.hpp"
+#include "Concepts/Pool.hpp"
+#include "Concepts/Sort.hpp"
+#include "Concepts/Stream.hpp"
+#if defined(__cpp_impl_coroutine)
+#include "Concepts/Task.hpp"
+#endif
+}
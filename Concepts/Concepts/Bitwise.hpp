@@ -0,0 +1,364 @@
+#pragma once
+
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2019 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+
+#include "CoreConcepts.hpp"
+#include "IteratorTraits.hpp"
+
+// For BitwiseComparable types, equality and hashing work on the object
+// representation directly unless by_value<T> opts the type out. Ordering always
+// follows operator <; memcmp is only used where byte order is value order. The
+// representation order, a consistent total order that is usually not operator <
+// order, is available separately as byte_compare and byte_less.
+
+namespace bitwise
+{
+
+  // Specialize with value = true for a BitwiseComparable type whose operator ==
+  // is not member-wise (it ignores a cached field, say). equal and hash then use
+  // operator == and std::hash<T> instead of the object bytes.
+  template<class T>
+  struct by_value
+  {
+    static constexpr bool value = false;
+  };
+
+  namespace detail
+  {
+
+    template<class T>
+    using std_hash = decltype(std::hash<T>{ }(std::declval<const T&>()));
+
+    template<class T>
+    constexpr bool byte_equality = BitwiseComparable<T> && !by_value<T>::value;
+
+    // Only single-byte unsigned values compare the same way memcmp orders them.
+    template<class T>
+    constexpr bool byte_ordered = sizeof(T) == 1 && (concepts::Unsigned<T> || concepts::Same<T, std::byte>);
+
+    inline std::uint64_t load64(const unsigned char *p) noexcept
+    {
+      std::uint64_t v;
+      std::memcpy(&v, p, sizeof(v));
+      return v;
+    }
+
+    inline std::uint64_t rotl(std::uint64_t v, unsigned r) noexcept
+    {
+      return (v << r) | (v >> (64 - r));
+    }
+
+    inline std::uint64_t mix(std::uint64_t acc, std::uint64_t word) noexcept
+    {
+      acc += word * 0xC2B2AE3D27D4EB4Full;
+      acc = rotl(acc, 31);
+      return acc * 0x9E3779B185EBCA87ull;
+    }
+
+    inline std::uint64_t avalanche(std::uint64_t h) noexcept
+    {
+      h ^= h >> 33;
+      h *= 0xFF51AFD7ED558CCDull;
+      h ^= h >> 33;
+      h *= 0xC4CEB9FE1A85EC53ull;
+      h ^= h >> 33;
+      return h;
+    }
+
+    // Four independent 64-bit lanes over 32-byte blocks, so the multiplies of
+    // neighbouring words overlap instead of forming one long dependency chain.
+    struct lanes
+    {
+      explicit lanes(std::uint64_t seed) noexcept
+        : v{ seed + 0x9E3779B185EBCA87ull + 0xC2B2AE3D27D4EB4Full, seed + 0xC2B2AE3D27D4EB4Full, seed, seed - 0x9E3779B185EBCA87ull } { }
+
+      void block(const unsigned char *p) noexcept
+      {
+        v[0] = mix(v[0], load64(p));
+        v[1] = mix(v[1], load64(p + 8));
+        v[2] = mix(v[2], load64(p + 16));
+        v[3] = mix(v[3], load64(p + 24));
+      }
+
+      std::uint64_t merge() const noexcept
+      {
+        return rotl(v[0], 1) + rotl(v[1], 7) + rotl(v[2], 12) + rotl(v[3], 18);
+      }
+
+      std::uint64_t v[4];
+    };
+
+    // Folds in the total size and the last (size % 32) bytes.
+    inline std::uint64_t finish(std::uint64_t h, std::uint64_t size, const unsigned char *p, const unsigned char *end) noexcept
+    {
+      h += size;
+
+      for (; end - p >= 8; p += 8)
+        h = rotl(h ^ mix(0, load64(p)), 27) * 0x9E3779B185EBCA87ull + 0x85EBCA77C2B2AE63ull;
+
+      if (p != end)
+      {
+        std::uint64_t tail = 0;
+        std::memcpy(&tail, p, static_cast<std::size_t>(end - p));
+        h = rotl(h ^ mix(0, tail), 23) * 0xC2B2AE3D27D4EB4Full + 0x165667B19E3779F9ull;
+      }
+
+      return avalanche(h);
+    }
+
+    constexpr std::uint64_t short_input = 0x27D4EB2F165667C5ull;
+
+    template<class It>
+    constexpr bool contiguous = concepts::Pointer<It>;
+
+  }
+
+  inline std::uint64_t hash_bytes(const void *data, std::size_t size, std::uint64_t seed = 0) noexcept
+  {
+    const auto *p = static_cast<const unsigned char*>(data);
+    const auto *end = p + size;
+
+    if (size < 32)
+      return detail::finish(seed + detail::short_input, size, p, end);
+
+    detail::lanes lanes(seed);
+    for (; end - p >= 32; p += 32)
+      lanes.block(p);
+    return detail::finish(lanes.merge(), size, p, end);
+  }
+
+  // hash_bytes over input that arrives in pieces. Feeding the same bytes in any
+  // split gives the same result as one hash_bytes call over all of them.
+  class byte_hasher
+  {
+  public:
+    explicit byte_hasher(std::uint64_t seed = 0) noexcept : m_seed(seed), m_lanes(seed) { }
+
+    void update(const void *data, std::size_t size) noexcept
+    {
+      const auto *p = static_cast<const unsigned char*>(data);
+      m_size += size;
+
+      if (m_buffered)
+      {
+        const std::size_t take = size < 32 - m_buffered ? size : 32 - m_buffered;
+        std::memcpy(m_buffer + m_buffered, p, take);
+        m_buffered += take;
+        p += take;
+        size -= take;
+        if (m_buffered < 32)
+          return;
+
+        m_lanes.block(m_buffer);
+        m_buffered = 0;
+      }
+
+      for (; size >= 32; p += 32, size -= 32)
+        m_lanes.block(p);
+
+      if (size)
+        std::memcpy(m_buffer, p, size);
+      m_buffered = size;
+    }
+
+    std::uint64_t digest() const noexcept
+    {
+      const std::uint64_t h = m_size < 32 ? m_seed + detail::short_input : m_lanes.merge();
+      return detail::finish(h, m_size, m_buffer, m_buffer + m_buffered);
+    }
+
+  private:
+    std::uint64_t m_seed;
+    detail::lanes m_lanes;
+    std::uint64_t m_size = 0;
+    std::size_t m_buffered = 0;
+    unsigned char m_buffer[32];
+  };
+
+  template<class T>
+  bool equal(const T &lhs, const T &rhs)
+  {
+    if constexpr (detail::byte_equality<T>)
+    {
+      return std::memcmp(&lhs, &rhs, sizeof(T)) == 0;
+    }
+    else
+    {
+      static_assert(exists<ops::equal, const T&, const T&>, "bitwise::equal requires BitwiseComparable<T> or operator ==");
+      return static_cast<bool>(lhs == rhs);
+    }
+  }
+
+  template<class T>
+  std::size_t hash(const T &value)
+  {
+    if constexpr (detail::byte_equality<T>)
+    {
+      return static_cast<std::size_t>(hash_bytes(&value, sizeof(T)));
+    }
+    else
+    {
+      static_assert(exists<detail::std_hash, T>, "bitwise::hash requires BitwiseComparable<T> or std::hash<T>; by_value<T> types need std::hash<T>");
+      return std::hash<T>{ }(value);
+    }
+  }
+
+  // Three-way operator < order.
+  template<class T>
+  int compare(const T &lhs, const T &rhs)
+  {
+    static_assert(exists<ops::less_than, const T&, const T&>, "bitwise::compare requires operator <; byte_compare orders by representation");
+    return lhs < rhs ? -1 : (rhs < lhs ? 1 : 0);
+  }
+
+  // Three-way memcmp order of the object representation. Consistent with equal
+  // for types whose equality is byte equality, but -1 sorts after 1 and 256
+  // before 1 on little-endian targets.
+  template<class T>
+  int byte_compare(const T &lhs, const T &rhs)
+  {
+    static_assert(BitwiseComparable<T>, "bitwise::byte_compare requires BitwiseComparable<T>");
+    const int r = std::memcmp(&lhs, &rhs, sizeof(T));
+    return (r > 0) - (r < 0);
+  }
+
+  template<class It1, class It2>
+  bool range_equal(It1 first1, It1 last1, It2 first2)
+  {
+    using value_t = iterator::value_type_t<It1>;
+    if constexpr (detail::contiguous<It1> && detail::contiguous<It2> &&
+                  concepts::Same<value_t, iterator::value_type_t<It2>> && detail::byte_equality<value_t>)
+    {
+      const auto count = static_cast<std::size_t>(last1 - first1);
+      return count == 0 || std::memcmp(first1, first2, count * sizeof(value_t)) == 0;
+    }
+    else
+    {
+      for (; first1 != last1; ++first1, ++first2)
+      {
+        if (!bitwise::equal(*first1, *first2))
+          return false;
+      }
+      return true;
+    }
+  }
+
+  // Byte-equality elements hash as their concatenated bytes, whatever the
+  // iterator, so a pointer range and an iterator range over the same values
+  // agree. Other elements combine their individual hashes.
+  template<class It>
+  std::size_t range_hash(It first, It last)
+  {
+    using value_t = iterator::value_type_t<It>;
+    if constexpr (detail::contiguous<It> && detail::byte_equality<value_t>)
+    {
+      return static_cast<std::size_t>(hash_bytes(first, static_cast<std::size_t>(last - first) * sizeof(value_t)));
+    }
+    else if constexpr (detail::byte_equality<value_t>)
+    {
+      byte_hasher hasher;
+      for (; first != last; ++first)
+      {
+        const value_t value = *first;
+        hasher.update(&value, sizeof(value));
+      }
+      return static_cast<std::size_t>(hasher.digest());
+    }
+    else
+    {
+      std::uint64_t h = 0;
+      std::uint64_t count = 0;
+      for (; first != last; ++first, ++count)
+        h = detail::mix(h, static_cast<std::uint64_t>(bitwise::hash(*first)));
+      return static_cast<std::size_t>(detail::avalanche(h + count));
+    }
+  }
+
+  // Lexicographic operator < order; memcmp does the work for byte strings.
+  template<class It1, class It2>
+  int range_compare(It1 first1, It1 last1, It2 first2, It2 last2)
+  {
+    using value_t = iterator::value_type_t<It1>;
+    if constexpr (detail::contiguous<It1> && detail::contiguous<It2> &&
+                  concepts::Same<value_t, iterator::value_type_t<It2>> && detail::byte_ordered<value_t>)
+    {
+      const auto n1 = static_cast<std::size_t>(last1 - first1);
+      const auto n2 = static_cast<std::size_t>(last2 - first2);
+      const std::size_t common = n1 < n2 ? n1 : n2;
+      const int r = common ? std::memcmp(first1, first2, common) : 0;
+      if (r != 0)
+        return (r > 0) - (r < 0);
+      return (n1 > n2) - (n1 < n2);
+    }
+    else
+    {
+      for (; first1 != last1 && first2 != last2; ++first1, ++first2)
+      {
+        if (const int r = bitwise::compare(*first1, *first2))
+          return r;
+      }
+      return (first1 != last1) - (first2 != last2);
+    }
+  }
+
+  // Drop-in functors for unordered containers and sorting.
+  template<class T>
+  struct hasher
+  {
+    std::size_t operator ()(const T &value) const { return bitwise::hash(value); }
+  };
+
+  template<class T>
+  struct equal_to
+  {
+    bool operator ()(const T &lhs, const T &rhs) const { return bitwise::equal(lhs, rhs); }
+  };
+
+  template<class T>
+  struct less
+  {
+    bool operator ()(const T &lhs, const T &rhs) const { return bitwise::compare(lhs, rhs) < 0; }
+  };
+
+  // For ordered containers that only need some strict weak order.
+  template<class T>
+  struct byte_less
+  {
+    bool operator ()(const T &lhs, const T &rhs) const { return bitwise::byte_compare(lhs, rhs) < 0; }
+  };
+
+}
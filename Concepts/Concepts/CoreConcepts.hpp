@@ -0,0 +1,267 @@
+#pragma once
+
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2019 Kurt Slagle - kurt_slagle@yahoo.com
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "Detail.hpp"
+#include "Traits.hpp"
+
+template<class From, class To>
+constexpr bool ConvertibleTo = require<
+  concepts::Convertible<From, To>,
+  exists<ops::explicit_conversion, From, To>
+>;
+
+template<class T>
+constexpr bool Destructable = require<
+  std::is_nothrow_destructible<T>::value
+>;
+
+template<class T, class ...Args>
+constexpr bool Constructable = require<
+  Destructable<T>,
+  concepts::Constructable<T, Args...>
+>;
+
+template<class T>
+constexpr bool DefaultConstructable = require<
+  Constructable<T>,
+  exists<ops::value_initialize, T>,
+  exists<ops::default_new, T>
+>;
+
+template<class T>
+constexpr bool MoveConstructable = require<
+  Constructable<T, T>,
+  ConvertibleTo<T, T>
+>;
+
+template<class T>
+constexpr bool CopyConstructable = require<
+  MoveConstructable<T>,
+  Constructable<T, traits::add_lvalue_reference_t<T>>, ConvertibleTo<traits::add_lvalue_reference_t<T>, T>,
+  Constructable<T, traits::add_lvalue_reference_t<const T>>, ConvertibleTo<traits::add_lvalue_reference_t<const T>, T>,
+  Constructable<T, const T>, ConvertibleTo<const T, T>
+>;
+
+// Stands in for std::common_reference_with, which has no C++17 equivalent.
+template<class T, class U>
+constexpr bool CommonWith = require<
+  exists<traits::common_type_t, T, U>
+>;
+
+template<class T, class U>
+constexpr bool Assignable = require<
+  concepts::LvalueReference<T>,
+  CommonWith<traits::const_lvalue_reference_t<T>, traits::const_lvalue_reference_t<U>>,
+  identical_to<T, ops::assign_from, T, U>
+>;
+
+namespace detail
+{
+  template<class T>
+  struct swappable_array : std::false_type { };
+}
+
+// Mirrors std::ranges::swap: an ADL swap, else move construction and move
+// assignment, else element-wise for arrays of known bound.
+template<class T>
+constexpr bool Swappable = either<
+  exists<detail::adl::unqualified_swap, traits::add_lvalue_reference_t<T>>,
+  require<MoveConstructable<T>, Assignable<traits::add_lvalue_reference_t<T>, T>>,
+  detail::swappable_array<T>::value
+>;
+
+namespace detail
+{
+  template<class T, std::size_t N>
+  struct swappable_array<T[N]> : std::bool_constant<Swappable<T>> { };
+}
+
+template<class T>
+constexpr bool Moveable = require<
+  concepts::Object<T>,
+  MoveConstructable<T>,
+  Assignable<traits::add_lvalue_reference_t<T>, T>,
+  Swappable<T>
+>;
+
+template<class T>
+constexpr bool Copyable = require<
+  CopyConstructable<T>,
+  Moveable<T>,
+  Assignable<traits::add_lvalue_reference_t<T>, traits::add_lvalue_reference_t<T>>,
+  Assignable<traits::add_lvalue_reference_t<T>, traits::add_lvalue_reference_t<const T>>,
+  Assignable<traits::add_lvalue_reference_t<T>, const T>
+>;
+
+template<class T>
+constexpr bool Semiregular = require<
+  Copyable<T>,
+  DefaultConstructable<T>
+>;
+
+// Usable in a boolean context: convertible to bool, and so is its negation.
+template<class T>
+constexpr bool Boolean = require<
+  ConvertibleTo<T, bool>,
+  converts_to<bool, ops::logical_not, T>
+>;
+
+template<class T, class U>
+constexpr bool WeaklyEqualityComparableWith = require<
+  Boolean<detected_t<ops::equal, traits::const_lvalue_reference_t<T>, traits::const_lvalue_reference_t<U>>>,
+  Boolean<detected_t<ops::not_equal, traits::const_lvalue_reference_t<T>, traits::const_lvalue_reference_t<U>>>,
+  Boolean<detected_t<ops::equal, traits::const_lvalue_reference_t<U>, traits::const_lvalue_reference_t<T>>>,
+  Boolean<detected_t<ops::not_equal, traits::const_lvalue_reference_t<U>, traits::const_lvalue_reference_t<T>>>
+>;
+
+template<class T>
+constexpr bool EqualityComparable = require<
+  WeaklyEqualityComparableWith<T, T>
+>;
+
+template<class T, class U>
+constexpr bool EqualityComparableWith = require<
+  EqualityComparable<T>,
+  EqualityComparable<U>,
+  CommonWith<traits::const_lvalue_reference_t<T>, traits::const_lvalue_reference_t<U>>,
+  WeaklyEqualityComparableWith<T, U>
+>;
+
+template<class T, class U>
+constexpr bool PartiallyOrderedWith = require<
+  Boolean<detected_t<ops::less_than, traits::const_lvalue_reference_t<T>, traits::const_lvalue_reference_t<U>>>,
+  Boolean<detected_t<ops::greater_than, traits::const_lvalue_reference_t<T>, traits::const_lvalue_reference_t<U>>>,
+  Boolean<detected_t<ops::less_equal, traits::const_lvalue_reference_t<T>, traits::const_lvalue_reference_t<U>>>,
+  Boolean<detected_t<ops::greater_equal, traits::const_lvalue_reference_t<T>, traits::const_lvalue_reference_t<U>>>,
+  Boolean<detected_t<ops::less_than, traits::const_lvalue_reference_t<U>, traits::const_lvalue_reference_t<T>>>,
+  Boolean<detected_t<ops::greater_than, traits::const_lvalue_reference_t<U>, traits::const_lvalue_reference_t<T>>>,
+  Boolean<detected_t<ops::less_equal, traits::const_lvalue_reference_t<U>, traits::const_lvalue_reference_t<T>>>,
+  Boolean<detected_t<ops::greater_equal, traits::const_lvalue_reference_t<U>, traits::const_lvalue_reference_t<T>>>
+>;
+
+template<class T>
+constexpr bool TotallyOrdered = require<
+  EqualityComparable<T>,
+  PartiallyOrderedWith<T, T>
+>;
+
+template<class T>
+constexpr bool Regular = require<
+  Semiregular<T>,
+  EqualityComparable<T>
+>;
+
+template<class T, class ...Args>
+constexpr bool Invocable = require<
+  concepts::Callable<T, Args...>
+>;
+
+template<class T, class ...Args>
+constexpr bool Predicate = require<
+  Invocable<T, Args...>,
+  Boolean<detected_t<concepts::ResultOfInvoke_t, T, Args...>>
+>;
+
+template<class Base, class Derived>
+constexpr bool DerivedFrom = require<
+  concepts::BaseOf<Base, Derived>,
+  concepts::Convertible<traits::add_pointer_t<const volatile Derived>, traits::add_pointer_t<const volatile Base>>
+>;
+
+template<class Base, class Derived>
+constexpr bool IsBaseOf = require<
+  concepts::BaseOf<Base, Derived>
+>;
+
+template<class T>
+constexpr bool Integral = require<
+  concepts::Integral<T>
+>;
+
+template<class T>
+constexpr bool SignedIntegral = require<
+  Integral<T>,
+  concepts::Signed<T>
+>;
+
+template<class T>
+constexpr bool UnsignedIntegral = require<
+  Integral<T>,
+  concepts::Unsigned<T>
+>;
+
+template<class T>
+constexpr bool FloatingPoint = require<
+  concepts::FloatingPoint<T>
+>;
+
+template<class T>
+constexpr bool Pointer = require<
+  concepts::Pointer<T>
+>;
+
+template<class T>
+constexpr bool BitwiseComparable = require<
+  concepts::TriviallyCopyable<T>,
+  concepts::UniqueObjectRepresentations<T>
+>;
+
+template<class T, class Handle>
+constexpr bool Awaiter = require<
+  exists<ops::await_ready, T>,
+  exists<ops::await_suspend, T, Handle>,
+  exists<ops::await_resume, T>,
+  converts_to<bool, ops::await_ready, T>,
+  either<
+  identical_to<void, ops::await_suspend, T, Handle>,
+  identical_to<bool, ops::await_suspend, T, Handle>,
+  converts_to<Handle, ops::await_suspend, T, Handle>
+  >
+>;
+
+#if defined(__cpp_impl_coroutine)
+template<class T, class Handle>
+constexpr bool Awaitable = either<
+  Awaiter<T, Handle>,
+  Awaiter<detected_t<ops::member_co_await, T>, Handle>,
+  Awaiter<detected_t<ops::free_co_await, T>, Handle>
+>;
+#else
+template<class T, class Handle>
+constexpr bool Awaitable = require<
+  Awaiter<T, Handle>
+>;
+#endif
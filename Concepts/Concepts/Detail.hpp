@@ -36,10 +36,10 @@ namespace concepts
 {
 
   template<class T, class U>
-  constexpr bool SwappableWith = exists<detail::swap_with, T, U>;
+  constexpr bool SwappableWith = std::is_swappable_with<T, U>::value;
 
   template<class T>
-  constexpr bool Swappable = SwappableWith<T&, T&>;
+  constexpr bool Swappable = SwappableWith<std::add_lvalue_reference_t<T>, std::add_lvalue_reference_t<T>>;
 
   template<class T>
   constexpr bool Pointer = std::is_pointer<T>::value;
@@ -50,7 +50,7 @@ namespace concepts
   template<class T>
   constexpr bool FloatingPoint = std::is_floating_point<T>::value;
 
-  template<class T, class U>
+  template<class T>
   constexpr bool Array = std::is_array<T>::value;
 
   template<class T>
@@ -59,7 +59,7 @@ namespace concepts
   template<class T>
   constexpr bool Class = std::is_class<T>::value;
 
-  template<class T, class U>
+  template<class T>
   constexpr bool Function = std::is_function<T>::value;
 
   template<class T>
@@ -110,11 +110,20 @@ namespace concepts
   template<class T>
   constexpr bool Trivial = std::is_trivial<T>::value;
 
+  template<class T>
+  constexpr bool TriviallyCopyable = std::is_trivially_copyable<T>::value;
+
+  template<class T>
+  constexpr bool UniqueObjectRepresentations = std::has_unique_object_representations<T>::value;
+
   template<class T>
   constexpr bool StandardLayout = std::is_standard_layout<T>::value;
 
-  template<class T, class U>
+#if (defined(_MSVC_LANG) ? _MSVC_LANG : __cplusplus) < 202002L
+  // std::is_literal_type is removed in C++20.
+  template<class T>
   constexpr bool LiteralType = std::is_literal_type<T>::value;
+#endif
 
   template<class T>
   constexpr bool Empty = std::is_empty<T>::value;
@@ -150,7 +159,7 @@ namespace concepts
   using has_constructor = decltype(T(std::declval<Args>()...));
 
   template<class T, class ...Args>
-  constexpr bool Constructable = exists<has_constructor, T, Args...>;
+  constexpr bool Constructable = std::is_constructible<T, Args...>::value;
 
   template<class T, class ...Args>
   constexpr bool TriviallyConstructable = std::is_trivially_constructible<T, Args...>::value;
@@ -174,16 +183,16 @@ namespace concepts
   using copy_assignable = decltype(std::declval<T&>() = std::declval<const T&>());
 
   template<class T>
-  constexpr bool CopyAssignable = identical_to<T&, copy_assignable, T>;
+  constexpr bool CopyAssignable = identical_to<std::add_lvalue_reference_t<T>, copy_assignable, T>;
 
   template<class T>
   using move_assignable = decltype(std::declval<T&>() = std::declval<T&&>());
 
   template<class T>
-  constexpr bool MoveAssignable = identical_to<T&, move_assignable, T>;
+  constexpr bool MoveAssignable = identical_to<std::add_lvalue_reference_t<T>, move_assignable, T>;
 
   template<class T, class U>
-  constexpr bool AssignableFrom = exists<ops::assignment, T, U>;
+  constexpr bool AssignableFrom = exists<ops::assign_from, T, U>;
 
   template<class T, class U>
   constexpr bool Same = std::is_same<T, U>::value;
@@ -30,7 +30,6 @@
 //`
 ////////////////////////////////////////////////////////////
 
-#include <algorithm>
 #include <utility>
 #include <type_traits>
 
@@ -98,6 +97,18 @@ namespace detail
 {
   template<class T, class U = T>
   using swap_with = decltype(std::swap(std::declval<T>(), std::declval<U>()));
+
+  // Unqualified swap as std::ranges::swap looks it up: the deleted overload
+  // hides the unconstrained std::swap template, so only ADL customizations or
+  // better-matching library overloads are detected.
+  namespace adl
+  {
+    template<class T>
+    void swap(T&, T&) = delete;
+
+    template<class T, class U = T>
+    using unqualified_swap = decltype(swap(std::declval<T>(), std::declval<U>()));
+  }
 }
 
 namespace ops
@@ -240,4 +251,47 @@ namespace ops
   template<class T>
   using comma = decltype(std::declval<T&>().operator,(std::declval<T&>()));
 
+  // Free-form forms of the above: member or non-member operators, any operand types.
+  template<class T, class U>
+  using assign_from = decltype(std::declval<T>() = std::declval<U>());
+
+  template<class T, class U>
+  using plus_assign = decltype(std::declval<T>() += std::declval<U>());
+
+  template<class T, class U>
+  using minus_assign = decltype(std::declval<T>() -= std::declval<U>());
+
+  template<class Out, class T>
+  using indirect_assign = decltype(*std::declval<Out>() = std::declval<T>());
+
+  // Rejects iterators whose operator * returns a non-proxy prvalue.
+  template<class Out, class T>
+  using const_indirect_assign = decltype(const_cast<const decltype(*std::declval<Out>())&&>(*std::declval<Out>()) = std::declval<T>());
+
+  template<class From, class To>
+  using explicit_conversion = decltype(static_cast<To>(std::declval<From>()));
+
+  template<class T>
+  using value_initialize = decltype(T{ });
+
+  template<class T>
+  using default_new = decltype(::new T);
+
+  template<class T>
+  using await_ready = decltype(std::declval<T&>().await_ready());
+
+  template<class T, class Handle>
+  using await_suspend = decltype(std::declval<T&>().await_suspend(std::declval<Handle>()));
+
+  template<class T>
+  using await_resume = decltype(std::declval<T&>().await_resume());
+
+#if defined(__cpp_impl_coroutine)
+  template<class T>
+  using member_co_await = decltype(std::declval<T>().operator co_await());
+
+  template<class T>
+  using free_co_await = decltype(operator co_await(std::declval<T>()));
+#endif
+
 }
\ No newline at end of file
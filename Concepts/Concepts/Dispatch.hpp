@@ -0,0 +1,84 @@
+#pragma once
+
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2019 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <utility>
+
+// Ordered fast-path selection without mutually exclusive enable_if
+// conditions. Each path is a function object; the first case whose condition
+// holds is chosen:
+//
+//   return dispatch::call<
+//     dispatch::when<Pointer<It> && BitwiseComparable<T>, copy_bytes>,
+//     dispatch::when<RandomAccessIterator<It>, copy_indexed>,
+//     dispatch::otherwise<copy_generic>
+//   >(first, last, out);
+//
+// Adding a path never touches the conditions of its siblings. Selection is a
+// partial specialization walk over the bool conditions, so only the chosen
+// implementation's operator () is instantiated and no overload set is
+// resolved. first_t<...>{ }(args...) skips the forwarding call entirely.
+
+namespace dispatch
+{
+
+  template<bool Condition, class Impl>
+  struct when { };
+
+  template<class Impl>
+  using otherwise = when<true, Impl>;
+
+  // No type when nothing matches, so an unsatisfied list is SFINAE-friendly.
+  template<class ...Cases>
+  struct first;
+
+  template<>
+  struct first<> { };
+
+  template<class Impl, class ...Rest>
+  struct first<when<true, Impl>, Rest...>
+  {
+    using type = Impl;
+  };
+
+  template<class Impl, class ...Rest>
+  struct first<when<false, Impl>, Rest...> : first<Rest...> { };
+
+  template<class ...Cases>
+  using first_t = typename first<Cases...>::type;
+
+  template<class ...Cases, class ...Args>
+  constexpr decltype(auto) call(Args &&...args)
+  {
+    return first_t<Cases...>{ }(std::forward<Args>(args)...);
+  }
+
+}
@@ -0,0 +1,501 @@
+#pragma once
+
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2019 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "CoreConcepts.hpp"
+
+namespace flags
+{
+
+  using word_t = std::uint64_t;
+  inline constexpr std::size_t word_bits = 64;
+  inline constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+  constexpr std::size_t words_for(std::size_t bits) noexcept
+  {
+    return (bits + word_bits - 1) / word_bits;
+  }
+
+  namespace detail
+  {
+
+    inline unsigned popcount(word_t w) noexcept
+    {
+#if defined(_MSC_VER) && defined(_M_X64)
+      return static_cast<unsigned>(__popcnt64(w));
+#elif defined(__GNUC__)
+      return static_cast<unsigned>(__builtin_popcountll(w));
+#else
+      w = w - ((w >> 1) & 0x5555555555555555ull);
+      w = (w & 0x3333333333333333ull) + ((w >> 2) & 0x3333333333333333ull);
+      w = (w + (w >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+      return static_cast<unsigned>((w * 0x0101010101010101ull) >> 56);
+#endif
+    }
+
+    // w must be non-zero.
+    inline unsigned countr_zero(word_t w) noexcept
+    {
+#if defined(_MSC_VER) && defined(_M_X64)
+      unsigned long idx;
+      _BitScanForward64(&idx, w);
+      return static_cast<unsigned>(idx);
+#elif defined(__GNUC__)
+      return static_cast<unsigned>(__builtin_ctzll(w));
+#else
+      unsigned n = 0;
+      while (!(w & 1))
+      {
+        w >>= 1;
+        ++n;
+      }
+      return n;
+#endif
+    }
+
+    template<class E>
+    using enum_count = decltype(E::count);
+
+  }
+
+  // Word-array kernels shared by enum_set and bitset. The loops are written
+  // over whole words with no cross-iteration dependency so the compiler turns
+  // them into SIMD-wide operations.
+  namespace kernels
+  {
+
+    inline void and_into(word_t *dst, const word_t *src, std::size_t n) noexcept
+    {
+      for (std::size_t i = 0; i < n; ++i)
+        dst[i] &= src[i];
+    }
+
+    inline void or_into(word_t *dst, const word_t *src, std::size_t n) noexcept
+    {
+      for (std::size_t i = 0; i < n; ++i)
+        dst[i] |= src[i];
+    }
+
+    inline void xor_into(word_t *dst, const word_t *src, std::size_t n) noexcept
+    {
+      for (std::size_t i = 0; i < n; ++i)
+        dst[i] ^= src[i];
+    }
+
+    inline void andnot_into(word_t *dst, const word_t *src, std::size_t n) noexcept
+    {
+      for (std::size_t i = 0; i < n; ++i)
+        dst[i] &= ~src[i];
+    }
+
+    inline std::size_t popcount(const word_t *words, std::size_t n) noexcept
+    {
+      std::size_t c0 = 0, c1 = 0, c2 = 0, c3 = 0;
+      std::size_t i = 0;
+      for (; i + 4 <= n; i += 4)
+      {
+        c0 += detail::popcount(words[i]);
+        c1 += detail::popcount(words[i + 1]);
+        c2 += detail::popcount(words[i + 2]);
+        c3 += detail::popcount(words[i + 3]);
+      }
+      for (; i < n; ++i)
+        c0 += detail::popcount(words[i]);
+      return c0 + c1 + c2 + c3;
+    }
+
+    inline bool any(const word_t *words, std::size_t n) noexcept
+    {
+      word_t acc = 0;
+      for (std::size_t i = 0; i < n; ++i)
+        acc |= words[i];
+      return acc != 0;
+    }
+
+    inline bool intersects(const word_t *a, const word_t *b, std::size_t n) noexcept
+    {
+      word_t acc = 0;
+      for (std::size_t i = 0; i < n; ++i)
+        acc |= a[i] & b[i];
+      return acc != 0;
+    }
+
+    inline bool subset_of(const word_t *a, const word_t *b, std::size_t n) noexcept
+    {
+      word_t acc = 0;
+      for (std::size_t i = 0; i < n; ++i)
+        acc |= a[i] & ~b[i];
+      return acc == 0;
+    }
+
+    inline bool equal(const word_t *a, const word_t *b, std::size_t n) noexcept
+    {
+      word_t acc = 0;
+      for (std::size_t i = 0; i < n; ++i)
+        acc |= a[i] ^ b[i];
+      return acc == 0;
+    }
+
+    // First set bit at index >= pos, or npos.
+    inline std::size_t find_from(const word_t *words, std::size_t n, std::size_t pos) noexcept
+    {
+      std::size_t idx = pos / word_bits;
+      if (idx >= n)
+        return npos;
+
+      word_t w = words[idx] & (~word_t(0) << (pos % word_bits));
+      for (;;)
+      {
+        if (w)
+          return idx * word_bits + detail::countr_zero(w);
+        if (++idx == n)
+          return npos;
+        w = words[idx];
+      }
+    }
+
+  }
+
+  template<class E>
+  struct enum_size
+  {
+    static_assert(exists<detail::enum_count, E>, "specialize flags::enum_size<E> or add a trailing E::count enumerator");
+    static constexpr std::size_t value = static_cast<std::size_t>(E::count);
+  };
+
+  template<class E>
+  constexpr std::size_t enum_size_v = enum_size<E>::value;
+
+  template<class E>
+  class enum_set
+  {
+  public:
+    static_assert(concepts::Enum<E>, "enum_set requires an enumeration type");
+
+    static constexpr std::size_t bits = enum_size_v<E>;
+    static constexpr std::size_t word_count = words_for(bits);
+
+    constexpr enum_set() noexcept : m_words{ } { }
+
+    constexpr enum_set(std::initializer_list<E> values) noexcept : m_words{ }
+    {
+      for (E e : values)
+        insert(e);
+    }
+
+    static constexpr enum_set all() noexcept
+    {
+      enum_set s;
+      for (std::size_t i = 0; i < word_count; ++i)
+        s.m_words[i] = ~word_t(0);
+      s.trim();
+      return s;
+    }
+
+    constexpr void insert(E e) noexcept { assert(index(e) < bits); m_words[index(e) / word_bits] |= mask(e); }
+    constexpr void erase(E e) noexcept { assert(index(e) < bits); m_words[index(e) / word_bits] &= ~mask(e); }
+    constexpr void flip(E e) noexcept { assert(index(e) < bits); m_words[index(e) / word_bits] ^= mask(e); }
+    constexpr bool contains(E e) const noexcept { assert(index(e) < bits); return (m_words[index(e) / word_bits] & mask(e)) != 0; }
+
+    void clear() noexcept { *this = enum_set(); }
+
+    std::size_t size() const noexcept { return kernels::popcount(m_words, word_count); }
+    bool empty() const noexcept { return !kernels::any(m_words, word_count); }
+
+    bool intersects(const enum_set &other) const noexcept { return kernels::intersects(m_words, other.m_words, word_count); }
+    bool subset_of(const enum_set &other) const noexcept { return kernels::subset_of(m_words, other.m_words, word_count); }
+
+    enum_set& operator &=(const enum_set &other) noexcept { kernels::and_into(m_words, other.m_words, word_count); return *this; }
+    enum_set& operator |=(const enum_set &other) noexcept { kernels::or_into(m_words, other.m_words, word_count); return *this; }
+    enum_set& operator ^=(const enum_set &other) noexcept { kernels::xor_into(m_words, other.m_words, word_count); return *this; }
+    enum_set& operator -=(const enum_set &other) noexcept { kernels::andnot_into(m_words, other.m_words, word_count); return *this; }
+
+    friend enum_set operator &(enum_set lhs, const enum_set &rhs) noexcept { return lhs &= rhs; }
+    friend enum_set operator |(enum_set lhs, const enum_set &rhs) noexcept { return lhs |= rhs; }
+    friend enum_set operator ^(enum_set lhs, const enum_set &rhs) noexcept { return lhs ^= rhs; }
+    friend enum_set operator -(enum_set lhs, const enum_set &rhs) noexcept { return lhs -= rhs; }
+
+    enum_set operator ~() const noexcept
+    {
+      enum_set s;
+      for (std::size_t i = 0; i < word_count; ++i)
+        s.m_words[i] = ~m_words[i];
+      s.trim();
+      return s;
+    }
+
+    friend bool operator ==(const enum_set &lhs, const enum_set &rhs) noexcept { return kernels::equal(lhs.m_words, rhs.m_words, word_count); }
+    friend bool operator !=(const enum_set &lhs, const enum_set &rhs) noexcept { return !(lhs == rhs); }
+
+    class iterator
+    {
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = E;
+      using difference_type = std::ptrdiff_t;
+      using pointer = const E*;
+      using reference = E;
+
+      iterator(const word_t *words, std::size_t pos) noexcept : m_words(words), m_pos(pos) { }
+
+      E operator *() const noexcept { return static_cast<E>(m_pos); }
+
+      iterator& operator ++() noexcept
+      {
+        m_pos = kernels::find_from(m_words, word_count, m_pos + 1);
+        return *this;
+      }
+
+      iterator operator ++(int) noexcept
+      {
+        iterator tmp = *this;
+        ++*this;
+        return tmp;
+      }
+
+      friend bool operator ==(const iterator &lhs, const iterator &rhs) noexcept { return lhs.m_pos == rhs.m_pos; }
+      friend bool operator !=(const iterator &lhs, const iterator &rhs) noexcept { return lhs.m_pos != rhs.m_pos; }
+
+    private:
+      const word_t *m_words;
+      std::size_t m_pos;
+    };
+
+    iterator begin() const noexcept { return iterator(m_words, kernels::find_from(m_words, word_count, 0)); }
+    iterator end() const noexcept { return iterator(m_words, npos); }
+
+    const word_t* words() const noexcept { return m_words; }
+
+  private:
+    static constexpr std::size_t index(E e) noexcept
+    {
+      return static_cast<std::size_t>(static_cast<traits::underlying_type_t<E>>(e));
+    }
+
+    static constexpr word_t mask(E e) noexcept
+    {
+      return word_t(1) << (index(e) % word_bits);
+    }
+
+    constexpr void trim() noexcept
+    {
+      if (bits % word_bits)
+        m_words[word_count - 1] &= (word_t(1) << (bits % word_bits)) - 1;
+    }
+
+    word_t m_words[word_count];
+  };
+
+  template<class E, class V>
+  class enum_map
+  {
+  public:
+    static_assert(concepts::Enum<E>, "enum_map requires an enumeration type");
+
+    static constexpr std::size_t extent = enum_size_v<E>;
+
+    using key_type = E;
+    using mapped_type = V;
+
+    V& operator [](E e) noexcept { assert(index(e) < extent); return m_values[index(e)]; }
+    const V& operator [](E e) const noexcept { assert(index(e) < extent); return m_values[index(e)]; }
+
+    static constexpr std::size_t size() noexcept { return extent; }
+
+    V* begin() noexcept { return m_values; }
+    V* end() noexcept { return m_values + extent; }
+    const V* begin() const noexcept { return m_values; }
+    const V* end() const noexcept { return m_values + extent; }
+
+    template<class F>
+    void for_each(F &&f)
+    {
+      for (std::size_t i = 0; i < extent; ++i)
+        f(static_cast<E>(i), m_values[i]);
+    }
+
+    template<class F>
+    void for_each(F &&f) const
+    {
+      for (std::size_t i = 0; i < extent; ++i)
+        f(static_cast<E>(i), m_values[i]);
+    }
+
+  private:
+    static constexpr std::size_t index(E e) noexcept
+    {
+      return static_cast<std::size_t>(static_cast<traits::underlying_type_t<E>>(e));
+    }
+
+    V m_values[extent]{ };
+  };
+
+  // Runtime-sized bitset. Bits past size() are always kept zero.
+  class bitset
+  {
+  public:
+    bitset() = default;
+    explicit bitset(std::size_t bits, bool value = false)
+      : m_words(words_for(bits), value ? ~word_t(0) : word_t(0)), m_bits(bits)
+    {
+      trim();
+    }
+
+    std::size_t size() const noexcept { return m_bits; }
+
+    void resize(std::size_t bits, bool value = false)
+    {
+      const std::size_t old_bits = m_bits;
+      m_words.resize(words_for(bits), value ? ~word_t(0) : word_t(0));
+      m_bits = bits;
+      if (value && old_bits < bits && old_bits % word_bits)
+        m_words[old_bits / word_bits] |= ~word_t(0) << (old_bits % word_bits);
+      trim();
+    }
+
+    void set(std::size_t pos) noexcept { assert(pos < m_bits); m_words[pos / word_bits] |= word_t(1) << (pos % word_bits); }
+    void reset(std::size_t pos) noexcept { assert(pos < m_bits); m_words[pos / word_bits] &= ~(word_t(1) << (pos % word_bits)); }
+    void flip(std::size_t pos) noexcept { assert(pos < m_bits); m_words[pos / word_bits] ^= word_t(1) << (pos % word_bits); }
+    bool test(std::size_t pos) const noexcept { assert(pos < m_bits); return (m_words[pos / word_bits] >> (pos % word_bits)) & 1; }
+
+    void reset() noexcept { std::fill(m_words.begin(), m_words.end(), word_t(0)); }
+
+    std::size_t count() const noexcept { return kernels::popcount(m_words.data(), m_words.size()); }
+    bool any() const noexcept { return kernels::any(m_words.data(), m_words.size()); }
+    bool none() const noexcept { return !any(); }
+
+    std::size_t find_first() const noexcept { return kernels::find_from(m_words.data(), m_words.size(), 0); }
+
+    // First set bit strictly after pos, or npos.
+    std::size_t find_next(std::size_t pos) const noexcept
+    {
+      return pos >= m_bits || pos + 1 >= m_bits ? npos : kernels::find_from(m_words.data(), m_words.size(), pos + 1);
+    }
+
+    bool intersects(const bitset &other) const noexcept
+    {
+      assert(m_bits == other.m_bits);
+      return kernels::intersects(m_words.data(), other.m_words.data(), m_words.size());
+    }
+
+    bool subset_of(const bitset &other) const noexcept
+    {
+      assert(m_bits == other.m_bits);
+      return kernels::subset_of(m_words.data(), other.m_words.data(), m_words.size());
+    }
+
+    bitset& operator &=(const bitset &other) noexcept
+    {
+      assert(m_bits == other.m_bits);
+      kernels::and_into(m_words.data(), other.m_words.data(), m_words.size());
+      return *this;
+    }
+
+    bitset& operator |=(const bitset &other) noexcept
+    {
+      assert(m_bits == other.m_bits);
+      kernels::or_into(m_words.data(), other.m_words.data(), m_words.size());
+      return *this;
+    }
+
+    bitset& operator ^=(const bitset &other) noexcept
+    {
+      assert(m_bits == other.m_bits);
+      kernels::xor_into(m_words.data(), other.m_words.data(), m_words.size());
+      return *this;
+    }
+
+    bitset& and_not(const bitset &other) noexcept
+    {
+      assert(m_bits == other.m_bits);
+      kernels::andnot_into(m_words.data(), other.m_words.data(), m_words.size());
+      return *this;
+    }
+
+    bitset& flip() noexcept
+    {
+      for (auto &w : m_words)
+        w = ~w;
+      trim();
+      return *this;
+    }
+
+    friend bitset operator &(bitset lhs, const bitset &rhs) { return std::move(lhs &= rhs); }
+    friend bitset operator |(bitset lhs, const bitset &rhs) { return std::move(lhs |= rhs); }
+    friend bitset operator ^(bitset lhs, const bitset &rhs) { return std::move(lhs ^= rhs); }
+
+    friend bool operator ==(const bitset &lhs, const bitset &rhs) noexcept
+    {
+      return lhs.m_bits == rhs.m_bits && kernels::equal(lhs.m_words.data(), rhs.m_words.data(), lhs.m_words.size());
+    }
+
+    friend bool operator !=(const bitset &lhs, const bitset &rhs) noexcept { return !(lhs == rhs); }
+
+    // Calls f(index) for every set bit, in increasing order.
+    template<class F>
+    void for_each_set(F &&f) const
+    {
+      for (std::size_t i = 0; i < m_words.size(); ++i)
+      {
+        for (word_t w = m_words[i]; w; w &= w - 1)
+          f(i * word_bits + detail::countr_zero(w));
+      }
+    }
+
+    word_t* words() noexcept { return m_words.data(); }
+    const word_t* words() const noexcept { return m_words.data(); }
+    std::size_t word_count() const noexcept { return m_words.size(); }
+
+  private:
+    void trim() noexcept
+    {
+      if (m_bits % word_bits)
+        m_words.back() &= (word_t(1) << (m_bits % word_bits)) - 1;
+    }
+
+    std::vector<word_t> m_words;
+    std::size_t m_bits = 0;
+  };
+
+}
@@ -0,0 +1,459 @@
+#pragma once
+
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2019 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define CONCEPTS_INSTRUMENT_RDTSC __rdtsc
+#elif defined(__x86_64__) || defined(__i386__)
+#define CONCEPTS_INSTRUMENT_RDTSC __builtin_ia32_rdtsc
+#endif
+
+#include "CoreConcepts.hpp"
+
+// Define CONCEPTS_DISABLE_INSTRUMENTATION to make instrumented(f, name) return f itself.
+
+namespace instrument
+{
+
+  struct site_snapshot
+  {
+    std::string name;
+    std::uint64_t count = 0;
+    std::uint64_t min_ticks = 0;
+    std::uint64_t max_ticks = 0;
+    double sum_ticks = 0;
+    double ticks_per_ns = 1;
+    std::vector<std::uint64_t> buckets;
+
+    double min_ns() const noexcept { return min_ticks / ticks_per_ns; }
+    double max_ns() const noexcept { return max_ticks / ticks_per_ns; }
+    double mean_ns() const noexcept { return count ? sum_ticks / count / ticks_per_ns : 0; }
+    double percentile_ns(double q) const noexcept;
+  };
+
+  namespace detail
+  {
+
+    // What instrumented() can wrap: a function object, a function pointer or a
+    // member pointer.
+    template<class F>
+    constexpr bool Wrappable = concepts::Class<F> || concepts::MemberPointer<F> ||
+      (concepts::Pointer<F> && concepts::Function<traits::remove_pointer_t<F>>);
+
+    inline std::uint64_t steady_ns() noexcept
+    {
+      using namespace std::chrono;
+      return static_cast<std::uint64_t>(duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count());
+    }
+
+    inline std::uint64_t ticks() noexcept
+    {
+#if defined(CONCEPTS_INSTRUMENT_RDTSC)
+      return CONCEPTS_INSTRUMENT_RDTSC();
+#else
+      return steady_ns();
+#endif
+    }
+
+    inline double calibrate() noexcept
+    {
+#if defined(CONCEPTS_INSTRUMENT_RDTSC)
+      const std::uint64_t ns0 = steady_ns();
+      const std::uint64_t t0 = ticks();
+      std::uint64_t ns1 = ns0;
+      while (ns1 - ns0 < 10000000)
+        ns1 = steady_ns();
+      const std::uint64_t t1 = ticks();
+      return static_cast<double>(t1 - t0) / static_cast<double>(ns1 - ns0);
+#else
+      return 1.0;
+#endif
+    }
+
+    inline double ticks_per_ns() noexcept
+    {
+      static const double ratio = calibrate();
+      return ratio;
+    }
+
+    constexpr unsigned most_significant_bit(std::uint64_t v) noexcept
+    {
+      unsigned bit = 0;
+      while (v >>= 1)
+        ++bit;
+      return bit;
+    }
+
+    // Log-linear buckets in the style of HdrHistogram: every power of two is
+    // split into sub_count linear buckets, giving ~6% relative precision.
+    class histogram
+    {
+    public:
+      static constexpr unsigned sub_bits = 4;
+      static constexpr std::size_t sub_count = std::size_t(1) << sub_bits;
+      static constexpr std::size_t bucket_count = (64 - sub_bits + 1) * sub_count;
+
+      static constexpr std::size_t bucket_of(std::uint64_t v) noexcept
+      {
+        if (v < sub_count)
+          return static_cast<std::size_t>(v);
+
+        const unsigned shift = most_significant_bit(v) - sub_bits;
+        return (shift + 1) * sub_count + static_cast<std::size_t>((v >> shift) & (sub_count - 1));
+      }
+
+      static constexpr std::uint64_t bucket_floor(std::size_t idx) noexcept
+      {
+        if (idx < sub_count)
+          return idx;
+
+        const std::size_t shift = idx / sub_count - 1;
+        return (sub_count + idx % sub_count) << shift;
+      }
+
+      // Only the owning thread writes, so plain load/store pairs suffice and the
+      // merging thread never sees a torn counter.
+      void record(std::uint64_t v) noexcept
+      {
+        bump(m_counts[bucket_of(v)], 1);
+        bump(m_total, 1);
+        bump(m_sum, v);
+        if (v < m_min.load(std::memory_order_relaxed))
+          m_min.store(v, std::memory_order_relaxed);
+        if (v > m_max.load(std::memory_order_relaxed))
+          m_max.store(v, std::memory_order_relaxed);
+      }
+
+      void merge_into(site_snapshot &out) const
+      {
+        const std::uint64_t total = m_total.load(std::memory_order_relaxed);
+        if (!total)
+          return;
+
+        out.min_ticks = out.count ? std::min(out.min_ticks, m_min.load(std::memory_order_relaxed)) : m_min.load(std::memory_order_relaxed);
+        out.max_ticks = std::max(out.max_ticks, m_max.load(std::memory_order_relaxed));
+        out.sum_ticks += static_cast<double>(m_sum.load(std::memory_order_relaxed));
+        out.count += total;
+        for (std::size_t i = 0; i < bucket_count; ++i)
+          out.buckets[i] += m_counts[i].load(std::memory_order_relaxed);
+      }
+
+      // Moves every count from `other` into this histogram and leaves `other`
+      // empty. Neither side may be recording at the same time.
+      void absorb(histogram &other) noexcept
+      {
+        const std::uint64_t total = other.m_total.exchange(0, std::memory_order_relaxed);
+        if (!total)
+          return;
+
+        for (std::size_t i = 0; i < bucket_count; ++i)
+          bump(m_counts[i], other.m_counts[i].exchange(0, std::memory_order_relaxed));
+        bump(m_total, total);
+        bump(m_sum, other.m_sum.exchange(0, std::memory_order_relaxed));
+
+        const std::uint64_t lo = other.m_min.exchange(std::numeric_limits<std::uint64_t>::max(), std::memory_order_relaxed);
+        const std::uint64_t hi = other.m_max.exchange(0, std::memory_order_relaxed);
+        if (lo < m_min.load(std::memory_order_relaxed))
+          m_min.store(lo, std::memory_order_relaxed);
+        if (hi > m_max.load(std::memory_order_relaxed))
+          m_max.store(hi, std::memory_order_relaxed);
+      }
+
+    private:
+      static void bump(std::atomic<std::uint64_t> &counter, std::uint64_t by) noexcept
+      {
+        counter.store(counter.load(std::memory_order_relaxed) + by, std::memory_order_relaxed);
+      }
+
+      std::atomic<std::uint64_t> m_counts[bucket_count]{ };
+      std::atomic<std::uint64_t> m_total{ 0 };
+      std::atomic<std::uint64_t> m_sum{ 0 };
+      std::atomic<std::uint64_t> m_min{ std::numeric_limits<std::uint64_t>::max() };
+      std::atomic<std::uint64_t> m_max{ 0 };
+    };
+
+    class site;
+
+    // The histograms one thread has attached to, indexed by site id. At thread
+    // exit each goes back to its site, so memory and snapshot() cost follow the
+    // number of live threads rather than every thread that ever ran.
+    struct thread_slots
+    {
+      struct slot
+      {
+        site *owner = nullptr;
+        histogram *local = nullptr;
+      };
+
+      ~thread_slots();
+
+      std::vector<slot> slots;
+    };
+
+    class site
+    {
+    public:
+      site(std::string name, std::size_t id) : m_name(std::move(name)), m_id(id) { }
+
+      const std::string& name() const noexcept { return m_name; }
+
+      histogram& local()
+      {
+        thread_local thread_slots owned;
+        if (m_id < owned.slots.size() && owned.slots[m_id].local)
+          return *owned.slots[m_id].local;
+        return attach(owned);
+      }
+
+      site_snapshot snapshot() const
+      {
+        site_snapshot out;
+        out.name = m_name;
+        out.ticks_per_ns = ticks_per_ns();
+        out.buckets.assign(histogram::bucket_count, 0);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_retired.merge_into(out);
+        for (const auto &h : m_histograms)
+          h->merge_into(out);
+        return out;
+      }
+
+      // Folds an exiting thread's counts into the retired totals and keeps its
+      // histogram for the next thread that attaches.
+      void retire(histogram &h)
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_retired.absorb(h);
+        m_free.push_back(&h);
+      }
+
+    private:
+      histogram& attach(thread_slots &owned)
+      {
+        if (owned.slots.size() <= m_id)
+          owned.slots.resize(m_id + 1);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        histogram *h;
+        if (!m_free.empty())
+        {
+          h = m_free.back();
+          m_free.pop_back();
+        }
+        else
+        {
+          m_histograms.push_back(std::make_unique<histogram>());
+          h = m_histograms.back().get();
+        }
+        owned.slots[m_id] = { this, h };
+        return *h;
+      }
+
+      std::string m_name;
+      std::size_t m_id;
+      mutable std::mutex m_mutex;
+      std::vector<std::unique_ptr<histogram>> m_histograms;
+      std::vector<histogram*> m_free;
+      histogram m_retired;
+    };
+
+    inline thread_slots::~thread_slots()
+    {
+      for (const slot &s : slots)
+      {
+        if (s.local)
+          s.owner->retire(*s.local);
+      }
+    }
+
+    // Sites are interned by name and never destroyed, so a thread exiting late
+    // in shutdown can still retire its histograms into them.
+    class registry
+    {
+    public:
+      static registry& instance()
+      {
+        static registry *r = new registry;
+        return *r;
+      }
+
+      site& get(const char *name)
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto &s : m_sites)
+        {
+          if (s->name() == name)
+            return *s;
+        }
+        m_sites.push_back(std::make_unique<site>(name, m_sites.size()));
+        return *m_sites.back();
+      }
+
+      std::vector<site_snapshot> snapshot() const
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::vector<site_snapshot> out;
+        out.reserve(m_sites.size());
+        for (const auto &s : m_sites)
+          out.push_back(s->snapshot());
+        return out;
+      }
+
+    private:
+      mutable std::mutex m_mutex;
+      std::vector<std::unique_ptr<site>> m_sites;
+    };
+
+    class scoped_timer
+    {
+    public:
+      explicit scoped_timer(histogram &h) noexcept : m_histogram(h), m_start(ticks()) { }
+      ~scoped_timer() { m_histogram.record(ticks() - m_start); }
+
+      scoped_timer(const scoped_timer &) = delete;
+      scoped_timer& operator =(const scoped_timer &) = delete;
+
+    private:
+      histogram &m_histogram;
+      std::uint64_t m_start;
+    };
+
+  }
+
+  inline double site_snapshot::percentile_ns(double q) const noexcept
+  {
+    if (!count)
+      return 0;
+
+    const double clamped = std::min(std::max(q, 0.0), 1.0);
+    const auto rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(clamped * count + 0.5));
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < buckets.size(); ++i)
+    {
+      seen += buckets[i];
+      if (seen >= rank)
+      {
+        const std::uint64_t upper = i + 1 < buckets.size() ? detail::histogram::bucket_floor(i + 1) - 1 : max_ticks;
+        return std::min(upper, max_ticks) / ticks_per_ns;
+      }
+    }
+    return max_ns();
+  }
+
+  template<class F>
+  class instrumented_fn
+  {
+  public:
+    instrumented_fn(F fn, detail::site &s) : m_fn(std::move(fn)), m_site(&s) { }
+
+    template<class ...Args, class = std::enable_if_t<Invocable<F&, Args&&...>>>
+    std::invoke_result_t<F&, Args&&...> operator ()(Args&& ...args)
+    {
+      detail::scoped_timer timer(m_site->local());
+      return std::invoke(m_fn, std::forward<Args>(args)...);
+    }
+
+    template<class ...Args, class = std::enable_if_t<Invocable<const F&, Args&&...>>>
+    std::invoke_result_t<const F&, Args&&...> operator ()(Args&& ...args) const
+    {
+      detail::scoped_timer timer(m_site->local());
+      return std::invoke(m_fn, std::forward<Args>(args)...);
+    }
+
+    const std::string& name() const noexcept { return m_site->name(); }
+
+  private:
+    F m_fn;
+    detail::site *m_site;
+  };
+
+#if defined(CONCEPTS_DISABLE_INSTRUMENTATION)
+  // Member pointers are wrapped so they stay callable as f(object, args...).
+  template<class F, class = std::enable_if_t<detail::Wrappable<traits::decay_t<F>>>>
+  auto instrumented(F &&fn, const char *)
+  {
+    if constexpr (concepts::MemberPointer<traits::decay_t<F>>)
+      return std::mem_fn(fn);
+    else
+      return traits::decay_t<F>(std::forward<F>(fn));
+  }
+
+  inline std::vector<site_snapshot> snapshot()
+  {
+    return { };
+  }
+#else
+  template<class F, class = std::enable_if_t<detail::Wrappable<traits::decay_t<F>>>>
+  instrumented_fn<traits::decay_t<F>> instrumented(F &&fn, const char *name)
+  {
+    return instrumented_fn<traits::decay_t<F>>(std::forward<F>(fn), detail::registry::instance().get(name));
+  }
+
+  // Merges every thread's histograms; safe to call while instrumented code runs.
+  inline std::vector<site_snapshot> snapshot()
+  {
+    return detail::registry::instance().snapshot();
+  }
+#endif
+
+  inline void write_report(std::ostream &os, const std::vector<site_snapshot> &sites)
+  {
+    os << "name,count,mean_ns,min_ns,p50_ns,p90_ns,p99_ns,p999_ns,max_ns\n";
+    for (const auto &s : sites)
+    {
+      os << s.name << ',' << s.count << ',' << s.mean_ns() << ',' << s.min_ns() << ','
+         << s.percentile_ns(0.5) << ',' << s.percentile_ns(0.9) << ',' << s.percentile_ns(0.99) << ','
+         << s.percentile_ns(0.999) << ',' << s.max_ns() << '\n';
+    }
+  }
+
+  inline void write_report(std::ostream &os)
+  {
+    write_report(os, snapshot());
+  }
+
+}
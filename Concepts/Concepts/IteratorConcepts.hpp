@@ -0,0 +1,141 @@
+#pragma once
+
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2019 Kurt Slagle - kurt_slagle@yahoo.com
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include "CoreConcepts.hpp"
+#include "IteratorTraits.hpp"
+
+template<class T>
+constexpr bool WeaklyIncrementable = require<
+  Moveable<T>,
+  SignedIntegral<detected_t<iterator::difference_t, T>>,
+  identical_to<traits::add_lvalue_reference_t<T>, ops::prefix_increment, traits::add_lvalue_reference_t<T>>,
+  exists<ops::postfix_increment, traits::add_lvalue_reference_t<T>>
+>;
+
+template<class T>
+constexpr bool Incrementable = require<
+  Regular<T>,
+  WeaklyIncrementable<T>,
+  identical_to<T, ops::postfix_increment, traits::add_lvalue_reference_t<T>>
+>;
+
+template<class T>
+constexpr bool WeaklyDecrementable = require<
+  Moveable<T>,
+  identical_to<traits::add_lvalue_reference_t<T>, ops::prefix_decrement, traits::add_lvalue_reference_t<T>>
+>;
+
+template<class T>
+constexpr bool Decrementable = require<
+  Regular<T>,
+  WeaklyDecrementable<T>,
+  identical_to<T, ops::postfix_decrement, traits::add_lvalue_reference_t<T>>
+>;
+
+template<class T>
+constexpr bool Readable = require<
+  exists<iterator::value_t, typename traits::remove_cvref<T>::type>,
+  exists<ops::dereference, traits::add_lvalue_reference_t<typename traits::remove_cvref<T>::type>>,
+  disallow<concepts::Void<detected_t<ops::dereference, traits::add_lvalue_reference_t<typename traits::remove_cvref<T>::type>>>>,
+  identical_to<
+    detected_t<ops::dereference, traits::add_lvalue_reference_t<typename traits::remove_cvref<T>::type>>,
+    ops::dereference, traits::const_lvalue_reference_t<typename traits::remove_cvref<T>::type>
+  >
+>;
+
+template<class Out, class T>
+constexpr bool Writeable = require<
+  exists<ops::indirect_assign, traits::add_lvalue_reference_t<Out>, T>,
+  exists<ops::indirect_assign, traits::add_rvalue_reference_t<Out>, T>,
+  exists<ops::const_indirect_assign, traits::add_lvalue_reference_t<Out>, T>,
+  exists<ops::const_indirect_assign, traits::add_rvalue_reference_t<Out>, T>
+>;
+
+template<class T>
+constexpr bool Iterator = require<
+  exists<ops::dereference, traits::add_lvalue_reference_t<T>>,
+  disallow<concepts::Void<detected_t<ops::dereference, traits::add_lvalue_reference_t<T>>>>,
+  WeaklyIncrementable<T>
+>;
+
+template<class S, class I>
+constexpr bool Sentinel = require<
+  Semiregular<S>,
+  Iterator<I>,
+  WeaklyEqualityComparableWith<S, I>
+>;
+
+template<class S, class I>
+constexpr bool SizedSentinel = require<
+  Sentinel<S, I>,
+  identical_to<detected_t<iterator::difference_t, I>, ops::binary_minus, S, I>,
+  identical_to<detected_t<iterator::difference_t, I>, ops::binary_minus, I, S>
+>;
+
+template<class T>
+constexpr bool InputIterator = require<
+  Iterator<T>,
+  Readable<T>,
+  concepts::BaseOf<std::input_iterator_tag, iterator::concept_t<T>>
+>;
+
+template<class T>
+constexpr bool ForwardIterator = require<
+  InputIterator<T>,
+  concepts::BaseOf<std::forward_iterator_tag, iterator::concept_t<T>>,
+  Incrementable<T>,
+  Sentinel<T, T>
+>;
+
+template<class T>
+constexpr bool BidirectionalIterator = require<
+  ForwardIterator<T>,
+  concepts::BaseOf<std::bidirectional_iterator_tag, iterator::concept_t<T>>,
+  Decrementable<T>
+>;
+
+template<class T>
+constexpr bool RandomAccessIterator = require<
+  BidirectionalIterator<T>,
+  concepts::BaseOf<std::random_access_iterator_tag, iterator::concept_t<T>>,
+  TotallyOrdered<T>,
+  SizedSentinel<T, T>,
+  identical_to<traits::add_lvalue_reference_t<T>, ops::plus_assign, traits::add_lvalue_reference_t<T>, detected_t<iterator::difference_t, T>>,
+  identical_to<T, ops::binary_plus, T, detected_t<iterator::difference_t, T>>,
+  identical_to<T, ops::binary_plus, detected_t<iterator::difference_t, T>, T>,
+  identical_to<traits::add_lvalue_reference_t<T>, ops::minus_assign, traits::add_lvalue_reference_t<T>, detected_t<iterator::difference_t, T>>,
+  identical_to<T, ops::binary_minus, T, detected_t<iterator::difference_t, T>>,
+  identical_to<
+    detected_t<ops::dereference, traits::add_lvalue_reference_t<T>>,
+    ops::subscript, traits::const_lvalue_reference_t<T>, detected_t<iterator::difference_t, T>
+  >
+>;
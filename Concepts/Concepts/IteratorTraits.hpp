@@ -0,0 +1,118 @@
+#pragma once
+
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2019 Kurt Slagle - kurt_slagle@yahoo.com
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <iterator>
+#include <type_traits>
+
+#include "Detect.hpp"
+#include "Dispatch.hpp"
+#include "Traits.hpp"
+
+namespace iterator
+{
+
+  template<class Iter>
+  using difference_type_t = typename std::iterator_traits<Iter>::difference_type;
+
+  template<class Iter>
+  using value_type_t = typename std::iterator_traits<Iter>::value_type;
+
+  template<class Iter>
+  using pointer_t = typename std::iterator_traits<Iter>::pointer;
+
+  template<class Iter>
+  using reference_t = typename std::iterator_traits<Iter>::reference;
+
+  template<class Iter>
+  using member_difference_type_t = typename Iter::difference_type;
+
+  template<class Iter>
+  using member_value_type_t = typename Iter::value_type;
+
+  template<class Iter>
+  using member_element_type_t = typename Iter::element_type;
+
+  template<class Iter>
+  using member_iterator_category_t = typename Iter::iterator_category;
+
+  template<class Iter>
+  using member_iterator_concept_t = typename Iter::iterator_concept;
+
+  namespace detail
+  {
+
+    template<class Iter>
+    struct signed_distance
+    {
+      using type = std::make_signed_t<ops::binary_minus<Iter, Iter>>;
+    };
+
+    template<class T>
+    struct remove_cv_of
+    {
+      using type = std::remove_cv_t<T>;
+    };
+
+    template<class Iter>
+    using value_member = detected_t<member_value_type_t, Iter>;
+
+    template<class Iter>
+    using element_member = detected_t<member_element_type_t, Iter>;
+
+  }
+
+  // The C++20 iter_difference_t, iter_value_t and ITER_CONCEPT, usable from
+  // C++17 and on types std::iterator_traits knows nothing about. A type with no
+  // difference or value type leaves the alias ill-formed, so they detect.
+  template<class Iter>
+  using difference_t = typename dispatch::first_t<
+    dispatch::when<exists<member_difference_type_t, Iter>, traits::type_identity<detected_t<member_difference_type_t, Iter>>>,
+    dispatch::when<std::is_integral<detected_t<ops::binary_minus, Iter, Iter>>::value, detail::signed_distance<Iter>>
+  >::type;
+
+  template<class Iter>
+  using value_t = typename dispatch::first_t<
+    dispatch::when<std::is_pointer<Iter>::value, detail::remove_cv_of<std::remove_pointer_t<Iter>>>,
+    dispatch::when<std::is_array<Iter>::value, detail::remove_cv_of<std::remove_extent_t<Iter>>>,
+    dispatch::when<exists<member_value_type_t, Iter> && !exists<member_element_type_t, Iter>, detail::remove_cv_of<detail::value_member<Iter>>>,
+    dispatch::when<exists<member_element_type_t, Iter> && !exists<member_value_type_t, Iter>, detail::remove_cv_of<detail::element_member<Iter>>>,
+    dispatch::when<std::is_same<std::remove_cv_t<detail::value_member<Iter>>, std::remove_cv_t<detail::element_member<Iter>>>::value
+                   && exists<member_value_type_t, Iter>, detail::remove_cv_of<detail::value_member<Iter>>>
+  >::type;
+
+  template<class Iter>
+  using concept_t = typename detected_or<
+    typename detected_or<std::random_access_iterator_tag, member_iterator_category_t, Iter>::type,
+    member_iterator_concept_t, Iter
+  >::type;
+
+}
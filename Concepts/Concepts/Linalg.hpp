@@ -0,0 +1,655 @@
+#pragma once
+
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2019 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "CoreConcepts.hpp"
+
+namespace linalg
+{
+
+  inline constexpr std::size_t dynamic = static_cast<std::size_t>(-1);
+
+#if defined(__AVX512F__)
+  inline constexpr std::size_t simd_alignment = 64;
+#elif defined(__AVX__)
+  inline constexpr std::size_t simd_alignment = 32;
+#else
+  inline constexpr std::size_t simd_alignment = 16;
+#endif
+
+  struct vector_tag { };
+  struct matrix_tag { };
+
+  namespace detail
+  {
+
+    // Small fixed-size objects are only aligned as far as their own size, so a
+    // vector<float, 3> is not padded out to a full SIMD register.
+    constexpr std::size_t storage_alignment(std::size_t bytes, std::size_t minimum) noexcept
+    {
+      std::size_t align = minimum;
+      while (align < bytes && align < simd_alignment)
+        align *= 2;
+      return align;
+    }
+
+    template<class T>
+    using leaf = typename T::leaf_tag;
+
+    // Leaves are held by reference, intermediate nodes by value.
+    template<class E>
+    using operand_t = traits::conditional_t<exists<leaf, E>, const E&, E>;
+
+    template<class T>
+    struct aligned_array_delete
+    {
+      void operator ()(T *ptr) const noexcept
+      {
+        ::operator delete(ptr, std::align_val_t{ simd_alignment });
+      }
+    };
+
+    template<class T>
+    using aligned_array = std::unique_ptr<T[], aligned_array_delete<T>>;
+
+    template<class T>
+    aligned_array<T> allocate(std::size_t count)
+    {
+      if (!count)
+        return nullptr;
+
+      auto *ptr = static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{ simd_alignment }));
+      std::uninitialized_value_construct_n(ptr, count);
+      return aligned_array<T>(ptr);
+    }
+
+    struct add
+    {
+      template<class A, class B>
+      static constexpr auto apply(const A &a, const B &b) { return a + b; }
+    };
+
+    struct subtract
+    {
+      template<class A, class B>
+      static constexpr auto apply(const A &a, const B &b) { return a - b; }
+    };
+
+    struct scale
+    {
+      template<class S, class A>
+      static constexpr auto apply(const S &s, const A &a) { return s * a; }
+    };
+
+    struct divide
+    {
+      template<class S, class A>
+      static constexpr auto apply(const S &s, const A &a) { return a / s; }
+    };
+
+    struct negate
+    {
+      template<class A>
+      static constexpr auto apply(const A &a) { return -a; }
+    };
+
+  }
+
+  template<class Kind, class E>
+  struct expr
+  {
+    constexpr const E& self() const noexcept { return static_cast<const E&>(*this); }
+  };
+
+  template<class Kind, class L, class R, class Op>
+  class binary_expr : public expr<Kind, binary_expr<Kind, L, R, Op>>
+  {
+  public:
+    using value_type = decltype(Op::apply(std::declval<typename L::value_type>(), std::declval<typename R::value_type>()));
+
+    constexpr binary_expr(const L &lhs, const R &rhs) : m_lhs(lhs), m_rhs(rhs)
+    {
+      assert(lhs.size() == rhs.size());
+      if constexpr (concepts::Same<Kind, matrix_tag>)
+        assert(lhs.rows() == rhs.rows() && lhs.cols() == rhs.cols());
+    }
+
+    constexpr std::size_t size() const noexcept { return m_lhs.size(); }
+    constexpr std::size_t rows() const noexcept { return m_lhs.rows(); }
+    constexpr std::size_t cols() const noexcept { return m_lhs.cols(); }
+
+    constexpr value_type operator [](std::size_t idx) const { return Op::apply(m_lhs[idx], m_rhs[idx]); }
+
+  private:
+    detail::operand_t<L> m_lhs;
+    detail::operand_t<R> m_rhs;
+  };
+
+  template<class Kind, class S, class E, class Op>
+  class scalar_expr : public expr<Kind, scalar_expr<Kind, S, E, Op>>
+  {
+  public:
+    using value_type = decltype(Op::apply(std::declval<S>(), std::declval<typename E::value_type>()));
+
+    constexpr scalar_expr(const S &scalar, const E &e) : m_scalar(scalar), m_expr(e) { }
+
+    constexpr std::size_t size() const noexcept { return m_expr.size(); }
+    constexpr std::size_t rows() const noexcept { return m_expr.rows(); }
+    constexpr std::size_t cols() const noexcept { return m_expr.cols(); }
+
+    constexpr value_type operator [](std::size_t idx) const { return Op::apply(m_scalar, m_expr[idx]); }
+
+  private:
+    S m_scalar;
+    detail::operand_t<E> m_expr;
+  };
+
+  template<class Kind, class E, class Op>
+  class unary_expr : public expr<Kind, unary_expr<Kind, E, Op>>
+  {
+  public:
+    using value_type = decltype(Op::apply(std::declval<typename E::value_type>()));
+
+    constexpr explicit unary_expr(const E &e) : m_expr(e) { }
+
+    constexpr std::size_t size() const noexcept { return m_expr.size(); }
+    constexpr std::size_t rows() const noexcept { return m_expr.rows(); }
+    constexpr std::size_t cols() const noexcept { return m_expr.cols(); }
+
+    constexpr value_type operator [](std::size_t idx) const { return Op::apply(m_expr[idx]); }
+
+  private:
+    detail::operand_t<E> m_expr;
+  };
+
+  template<class K, class L, class R>
+  constexpr binary_expr<K, L, R, detail::add> operator +(const expr<K, L> &lhs, const expr<K, R> &rhs)
+  {
+    return { lhs.self(), rhs.self() };
+  }
+
+  template<class K, class L, class R>
+  constexpr binary_expr<K, L, R, detail::subtract> operator -(const expr<K, L> &lhs, const expr<K, R> &rhs)
+  {
+    return { lhs.self(), rhs.self() };
+  }
+
+  template<class K, class E>
+  constexpr unary_expr<K, E, detail::negate> operator -(const expr<K, E> &e)
+  {
+    return unary_expr<K, E, detail::negate>(e.self());
+  }
+
+  template<class S, class K, class E, class = std::enable_if_t<concepts::Arithmetic<S>>>
+  constexpr scalar_expr<K, S, E, detail::scale> operator *(const S &scalar, const expr<K, E> &e)
+  {
+    return { scalar, e.self() };
+  }
+
+  template<class S, class K, class E, class = std::enable_if_t<concepts::Arithmetic<S>>>
+  constexpr scalar_expr<K, S, E, detail::scale> operator *(const expr<K, E> &e, const S &scalar)
+  {
+    return { scalar, e.self() };
+  }
+
+  template<class S, class K, class E, class = std::enable_if_t<concepts::Arithmetic<S>>>
+  constexpr scalar_expr<K, S, E, detail::divide> operator /(const expr<K, E> &e, const S &scalar)
+  {
+    return { scalar, e.self() };
+  }
+
+  namespace detail
+  {
+
+    // The single loop every expression collapses into.
+    template<class T, class E>
+    constexpr void evaluate(T *out, const E &e, std::size_t count)
+    {
+      for (std::size_t i = 0; i < count; ++i)
+        out[i] = static_cast<T>(e[i]);
+    }
+
+    template<class T, class E, class Op>
+    constexpr void evaluate_update(T *out, const E &e, std::size_t count, Op)
+    {
+      for (std::size_t i = 0; i < count; ++i)
+        out[i] = static_cast<T>(Op::apply(out[i], e[i]));
+    }
+
+  }
+
+  template<class T, std::size_t N = dynamic>
+  class vector : public expr<vector_tag, vector<T, N>>
+  {
+  public:
+    static_assert(concepts::Arithmetic<T>, "linalg::vector requires an arithmetic element type");
+    static_assert(N > 0, "linalg::vector requires a non-zero size");
+
+    using leaf_tag = void;
+    using value_type = T;
+
+    constexpr vector() noexcept : m_data{ } { }
+
+    constexpr vector(std::initializer_list<T> values) : m_data{ }
+    {
+      assert(values.size() <= N);
+      std::size_t idx = 0;
+      for (const T &value : values)
+        m_data[idx++] = value;
+    }
+
+    template<class E>
+    constexpr vector(const expr<vector_tag, E> &e) : m_data{ }
+    {
+      assert(e.self().size() == N);
+      detail::evaluate(m_data, e.self(), N);
+    }
+
+    template<class E>
+    constexpr vector& operator =(const expr<vector_tag, E> &e)
+    {
+      assert(e.self().size() == N);
+      detail::evaluate(m_data, e.self(), N);
+      return *this;
+    }
+
+    template<class E>
+    constexpr vector& operator +=(const expr<vector_tag, E> &e)
+    {
+      assert(e.self().size() == N);
+      detail::evaluate_update(m_data, e.self(), N, detail::add{ });
+      return *this;
+    }
+
+    template<class E>
+    constexpr vector& operator -=(const expr<vector_tag, E> &e)
+    {
+      assert(e.self().size() == N);
+      detail::evaluate_update(m_data, e.self(), N, detail::subtract{ });
+      return *this;
+    }
+
+    static constexpr std::size_t size() noexcept { return N; }
+
+    constexpr T& operator [](std::size_t idx) noexcept { return m_data[idx]; }
+    constexpr const T& operator [](std::size_t idx) const noexcept { return m_data[idx]; }
+
+    constexpr T* data() noexcept { return m_data; }
+    constexpr const T* data() const noexcept { return m_data; }
+
+    constexpr T* begin() noexcept { return m_data; }
+    constexpr T* end() noexcept { return m_data + N; }
+    constexpr const T* begin() const noexcept { return m_data; }
+    constexpr const T* end() const noexcept { return m_data + N; }
+
+  private:
+    alignas(detail::storage_alignment(sizeof(T) * N, alignof(T))) T m_data[N];
+  };
+
+  template<class T>
+  class vector<T, dynamic> : public expr<vector_tag, vector<T, dynamic>>
+  {
+  public:
+    static_assert(concepts::Arithmetic<T>, "linalg::vector requires an arithmetic element type");
+
+    using leaf_tag = void;
+    using value_type = T;
+
+    vector() noexcept = default;
+
+    explicit vector(std::size_t size) : m_data(detail::allocate<T>(size)), m_size(size) { }
+
+    vector(std::initializer_list<T> values) : vector(values.size())
+    {
+      std::copy(values.begin(), values.end(), m_data.get());
+    }
+
+    vector(const vector &other) : vector(other.m_size)
+    {
+      std::copy(other.begin(), other.end(), m_data.get());
+    }
+
+    vector(vector &&other) noexcept : m_data(std::move(other.m_data)), m_size(std::exchange(other.m_size, 0)) { }
+
+    template<class E>
+    vector(const expr<vector_tag, E> &e) : vector(e.self().size())
+    {
+      detail::evaluate(m_data.get(), e.self(), m_size);
+    }
+
+    vector& operator =(const vector &other)
+    {
+      if (this != &other)
+        *this = static_cast<const expr<vector_tag, vector>&>(other);
+      return *this;
+    }
+
+    vector& operator =(vector &&other) noexcept
+    {
+      m_data = std::move(other.m_data);
+      m_size = std::exchange(other.m_size, 0);
+      return *this;
+    }
+
+    template<class E>
+    vector& operator =(const expr<vector_tag, E> &e)
+    {
+      const std::size_t size = e.self().size();
+      if (size != m_size)
+      {
+        // Evaluate before releasing storage: the expression may refer to *this.
+        vector result(e);
+        return *this = std::move(result);
+      }
+      detail::evaluate(m_data.get(), e.self(), m_size);
+      return *this;
+    }
+
+    template<class E>
+    vector& operator +=(const expr<vector_tag, E> &e)
+    {
+      assert(e.self().size() == m_size);
+      detail::evaluate_update(m_data.get(), e.self(), m_size, detail::add{ });
+      return *this;
+    }
+
+    template<class E>
+    vector& operator -=(const expr<vector_tag, E> &e)
+    {
+      assert(e.self().size() == m_size);
+      detail::evaluate_update(m_data.get(), e.self(), m_size, detail::subtract{ });
+      return *this;
+    }
+
+    std::size_t size() const noexcept { return m_size; }
+
+    T& operator [](std::size_t idx) noexcept { return m_data[idx]; }
+    const T& operator [](std::size_t idx) const noexcept { return m_data[idx]; }
+
+    T* data() noexcept { return m_data.get(); }
+    const T* data() const noexcept { return m_data.get(); }
+
+    T* begin() noexcept { return m_data.get(); }
+    T* end() noexcept { return m_data.get() + m_size; }
+    const T* begin() const noexcept { return m_data.get(); }
+    const T* end() const noexcept { return m_data.get() + m_size; }
+
+  private:
+    detail::aligned_array<T> m_data;
+    std::size_t m_size = 0;
+  };
+
+  template<class T, std::size_t R = dynamic, std::size_t C = R>
+  class matrix : public expr<matrix_tag, matrix<T, R, C>>
+  {
+  public:
+    static_assert(concepts::Arithmetic<T>, "linalg::matrix requires an arithmetic element type");
+    static_assert(R > 0 && C > 0, "linalg::matrix requires non-zero dimensions");
+
+    using leaf_tag = void;
+    using value_type = T;
+
+    constexpr matrix() noexcept : m_data{ } { }
+
+    // Row-major; missing trailing elements are zero.
+    constexpr matrix(std::initializer_list<T> values) : m_data{ }
+    {
+      assert(values.size() <= R * C);
+      std::size_t idx = 0;
+      for (const T &value : values)
+        m_data[idx++] = value;
+    }
+
+    template<class E>
+    constexpr matrix(const expr<matrix_tag, E> &e) : m_data{ }
+    {
+      assert(e.self().rows() == R && e.self().cols() == C);
+      detail::evaluate(m_data, e.self(), R * C);
+    }
+
+    template<class E>
+    constexpr matrix& operator =(const expr<matrix_tag, E> &e)
+    {
+      assert(e.self().rows() == R && e.self().cols() == C);
+      detail::evaluate(m_data, e.self(), R * C);
+      return *this;
+    }
+
+    static constexpr std::size_t rows() noexcept { return R; }
+    static constexpr std::size_t cols() noexcept { return C; }
+    static constexpr std::size_t size() noexcept { return R * C; }
+
+    constexpr T& operator ()(std::size_t r, std::size_t c) noexcept { return m_data[r * C + c]; }
+    constexpr const T& operator ()(std::size_t r, std::size_t c) const noexcept { return m_data[r * C + c]; }
+
+    constexpr T& operator [](std::size_t idx) noexcept { return m_data[idx]; }
+    constexpr const T& operator [](std::size_t idx) const noexcept { return m_data[idx]; }
+
+    constexpr T* row(std::size_t r) noexcept { return m_data + r * C; }
+    constexpr const T* row(std::size_t r) const noexcept { return m_data + r * C; }
+
+    constexpr T* data() noexcept { return m_data; }
+    constexpr const T* data() const noexcept { return m_data; }
+
+  private:
+    alignas(detail::storage_alignment(sizeof(T) * R * C, alignof(T))) T m_data[R * C];
+  };
+
+  template<class T>
+  class matrix<T, dynamic, dynamic> : public expr<matrix_tag, matrix<T, dynamic, dynamic>>
+  {
+  public:
+    static_assert(concepts::Arithmetic<T>, "linalg::matrix requires an arithmetic element type");
+
+    using leaf_tag = void;
+    using value_type = T;
+
+    matrix() noexcept = default;
+
+    matrix(std::size_t rows, std::size_t cols) : m_data(detail::allocate<T>(rows * cols)), m_rows(rows), m_cols(cols) { }
+
+    matrix(const matrix &other) : matrix(other.m_rows, other.m_cols)
+    {
+      std::copy(other.data(), other.data() + other.size(), m_data.get());
+    }
+
+    matrix(matrix &&other) noexcept
+      : m_data(std::move(other.m_data)), m_rows(std::exchange(other.m_rows, 0)), m_cols(std::exchange(other.m_cols, 0)) { }
+
+    template<class E>
+    matrix(const expr<matrix_tag, E> &e) : matrix(e.self().rows(), e.self().cols())
+    {
+      detail::evaluate(m_data.get(), e.self(), size());
+    }
+
+    matrix& operator =(const matrix &other)
+    {
+      if (this != &other)
+        *this = static_cast<const expr<matrix_tag, matrix>&>(other);
+      return *this;
+    }
+
+    matrix& operator =(matrix &&other) noexcept
+    {
+      m_data = std::move(other.m_data);
+      m_rows = std::exchange(other.m_rows, 0);
+      m_cols = std::exchange(other.m_cols, 0);
+      return *this;
+    }
+
+    template<class E>
+    matrix& operator =(const expr<matrix_tag, E> &e)
+    {
+      if (e.self().rows() != m_rows || e.self().cols() != m_cols)
+      {
+        matrix result(e);
+        return *this = std::move(result);
+      }
+      detail::evaluate(m_data.get(), e.self(), size());
+      return *this;
+    }
+
+    std::size_t rows() const noexcept { return m_rows; }
+    std::size_t cols() const noexcept { return m_cols; }
+    std::size_t size() const noexcept { return m_rows * m_cols; }
+
+    T& operator ()(std::size_t r, std::size_t c) noexcept { return m_data[r * m_cols + c]; }
+    const T& operator ()(std::size_t r, std::size_t c) const noexcept { return m_data[r * m_cols + c]; }
+
+    T& operator [](std::size_t idx) noexcept { return m_data[idx]; }
+    const T& operator [](std::size_t idx) const noexcept { return m_data[idx]; }
+
+    T* row(std::size_t r) noexcept { return m_data.get() + r * m_cols; }
+    const T* row(std::size_t r) const noexcept { return m_data.get() + r * m_cols; }
+
+    T* data() noexcept { return m_data.get(); }
+    const T* data() const noexcept { return m_data.get(); }
+
+  private:
+    detail::aligned_array<T> m_data;
+    std::size_t m_rows = 0;
+    std::size_t m_cols = 0;
+  };
+
+  template<class K, class L, class R>
+  constexpr auto dot(const expr<K, L> &lhs, const expr<K, R> &rhs)
+  {
+    assert(lhs.self().size() == rhs.self().size());
+    traits::common_type_t<typename L::value_type, typename R::value_type> sum{ };
+    for (std::size_t i = 0; i < lhs.self().size(); ++i)
+      sum += lhs.self()[i] * rhs.self()[i];
+    return sum;
+  }
+
+  namespace detail
+  {
+
+    // C += A * B for row-major operands. The loops are tiled so a block of B
+    // stays in cache while it is reused, and the innermost loop runs over a
+    // contiguous row of C and B so it vectorizes.
+    template<class T>
+    void gemm_blocked(const T *a, const T *b, T *c, std::size_t m, std::size_t n, std::size_t k)
+    {
+      constexpr std::size_t block_m = 64;
+      constexpr std::size_t block_k = 256;
+      constexpr std::size_t block_n = 512;
+
+      for (std::size_t ii = 0; ii < m; ii += block_m)
+      {
+        const std::size_t i_end = std::min(ii + block_m, m);
+        for (std::size_t kk = 0; kk < k; kk += block_k)
+        {
+          const std::size_t k_end = std::min(kk + block_k, k);
+          for (std::size_t jj = 0; jj < n; jj += block_n)
+          {
+            const std::size_t j_end = std::min(jj + block_n, n);
+            for (std::size_t i = ii; i < i_end; ++i)
+            {
+              T *__restrict c_row = c + i * n;
+              for (std::size_t p = kk; p < k_end; ++p)
+              {
+                const T a_ip = a[i * k + p];
+                const T *__restrict b_row = b + p * n;
+                for (std::size_t j = jj; j < j_end; ++j)
+                  c_row[j] += a_ip * b_row[j];
+              }
+            }
+          }
+        }
+      }
+    }
+
+  }
+
+  template<class T>
+  matrix<T> operator *(const matrix<T> &lhs, const matrix<T> &rhs)
+  {
+    assert(lhs.cols() == rhs.rows());
+    matrix<T> out(lhs.rows(), rhs.cols());
+    detail::gemm_blocked(lhs.data(), rhs.data(), out.data(), lhs.rows(), rhs.cols(), lhs.cols());
+    return out;
+  }
+
+  template<class T, std::size_t R, std::size_t K, std::size_t C>
+  constexpr matrix<T, R, C> operator *(const matrix<T, R, K> &lhs, const matrix<T, K, C> &rhs)
+  {
+    matrix<T, R, C> out;
+    for (std::size_t i = 0; i < R; ++i)
+    {
+      for (std::size_t p = 0; p < K; ++p)
+      {
+        const T a_ip = lhs(i, p);
+        for (std::size_t j = 0; j < C; ++j)
+          out(i, j) += a_ip * rhs(p, j);
+      }
+    }
+    return out;
+  }
+
+  template<class T>
+  vector<T> operator *(const matrix<T> &lhs, const vector<T> &rhs)
+  {
+    assert(lhs.cols() == rhs.size());
+    vector<T> out(lhs.rows());
+    for (std::size_t i = 0; i < lhs.rows(); ++i)
+    {
+      const T *row = lhs.row(i);
+      T sum{ };
+      for (std::size_t j = 0; j < lhs.cols(); ++j)
+        sum += row[j] * rhs[j];
+      out[i] = sum;
+    }
+    return out;
+  }
+
+  template<class T, std::size_t R, std::size_t C>
+  constexpr vector<T, R> operator *(const matrix<T, R, C> &lhs, const vector<T, C> &rhs)
+  {
+    vector<T, R> out;
+    for (std::size_t i = 0; i < R; ++i)
+    {
+      T sum{ };
+      for (std::size_t j = 0; j < C; ++j)
+        sum += lhs(i, j) * rhs[j];
+      out[i] = sum;
+    }
+    return out;
+  }
+
+}
@@ -0,0 +1,228 @@
+#pragma once
+
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2019 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "CoreConcepts.hpp"
+
+namespace pool
+{
+
+  namespace detail
+  {
+
+    template<class T>
+    using reset_hook = decltype(std::declval<T&>().reset());
+
+    template<class T>
+    using clear_hook = decltype(std::declval<T&>().clear());
+
+  }
+
+  // How recycle() empties a T. The primary template calls T::reset() if
+  // present, otherwise T::clear(); only trivially copyable types, which own no
+  // buffers, fall back to assigning T(). Anything else must specialize this
+  // with a static reset(T&) that clears the members but keeps their capacity:
+  //
+  //   template<>
+  //   struct pool::recycle_traits<request>
+  //   {
+  //     static void reset(request &r) { r.ids.clear(); r.body.clear(); }
+  //   };
+  template<class T>
+  struct recycle_traits
+  {
+    static void reset(T &object)
+    {
+      if constexpr (exists<detail::reset_hook, T>)
+      {
+        object.reset();
+      }
+      else if constexpr (exists<detail::clear_hook, T>)
+      {
+        object.clear();
+      }
+      else
+      {
+        static_assert(concepts::TriviallyCopyable<T>, "pool::recycle requires T::reset(), T::clear() or a pool::recycle_traits<T> specialization; assigning T() would free the buffers T owns");
+        object = T();
+      }
+    }
+  };
+
+  // Returns an object to a reusable state while keeping whatever capacity it owns.
+  template<class T>
+  void recycle(T &object)
+  {
+    recycle_traits<T>::reset(object);
+  }
+
+  // Process-wide pool of recycled T objects. Each thread keeps a small local
+  // free list that it uses without locking; batches move to and from a shared
+  // overflow list only when the local list runs empty or full. Use a distinct
+  // Tag to get an independent pool for the same T.
+  template<class T, class Tag = void>
+  class object_pool
+  {
+  public:
+    static_assert(DefaultConstructable<T>, "object_pool requires a default constructable type");
+    static_assert(Moveable<T>, "object_pool requires a moveable type");
+
+    static constexpr std::size_t local_capacity = 64;
+    static constexpr std::size_t batch_size = local_capacity / 2;
+
+    struct recycler
+    {
+      void operator ()(T *object) const { object_pool::release(object); }
+    };
+
+    using handle = std::unique_ptr<T, recycler>;
+
+    static handle acquire()
+    {
+      return handle(acquire_raw());
+    }
+
+    static T* acquire_raw()
+    {
+      auto &cache = local();
+      if (cache.items.empty())
+        shared().take(cache.items, batch_size);
+
+      if (cache.items.empty())
+        return new T();
+
+      T *object = cache.items.back();
+      cache.items.pop_back();
+      return object;
+    }
+
+    static void release(T *object)
+    {
+      if (!object)
+        return;
+
+      recycle(*object);
+
+      auto &cache = local();
+      if (cache.items.size() >= local_capacity)
+        shared().give(cache.items, batch_size);
+      cache.items.push_back(object);
+    }
+
+    // Pre-populates the shared list so the first requests do not allocate.
+    static void reserve(std::size_t count)
+    {
+      std::vector<T*> fresh;
+      fresh.reserve(count);
+      for (std::size_t i = 0; i < count; ++i)
+        fresh.push_back(new T());
+      shared().give(fresh, fresh.size());
+    }
+
+    static std::size_t shared_size()
+    {
+      return shared().size();
+    }
+
+  private:
+    class overflow
+    {
+    public:
+      ~overflow()
+      {
+        for (T *object : m_items)
+          delete object;
+      }
+
+      void take(std::vector<T*> &into, std::size_t count)
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const std::size_t n = count < m_items.size() ? count : m_items.size();
+        into.insert(into.end(), m_items.end() - n, m_items.end());
+        m_items.resize(m_items.size() - n);
+      }
+
+      void give(std::vector<T*> &from, std::size_t count)
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const std::size_t n = count < from.size() ? count : from.size();
+        m_items.insert(m_items.end(), from.end() - n, from.end());
+        from.resize(from.size() - n);
+      }
+
+      std::size_t size()
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_items.size();
+      }
+
+    private:
+      std::mutex m_mutex;
+      std::vector<T*> m_items;
+    };
+
+    struct local_cache
+    {
+      local_cache()
+      {
+        // Construct the shared list first so it outlives every thread cache.
+        shared();
+        items.reserve(local_capacity);
+      }
+
+      ~local_cache()
+      {
+        shared().give(items, items.size());
+      }
+
+      std::vector<T*> items;
+    };
+
+    static overflow& shared()
+    {
+      static overflow instance;
+      return instance;
+    }
+
+    static local_cache& local()
+    {
+      thread_local local_cache cache;
+      return cache;
+    }
+  };
+
+}
@@ -0,0 +1,210 @@
+#pragma once
+
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2019 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "CoreConcepts.hpp"
+#include "IteratorTraits.hpp"
+
+namespace sorting
+{
+
+  inline constexpr std::size_t indirect_threshold = 256;
+
+  // Sorting an index array and permuting once beats sorting in place when each
+  // move is expensive, or when a throwing move could leave the range half-sorted.
+  template<class T>
+  constexpr bool PreferIndirect = either<
+    disallow<concepts::NothrowConstructable<T, T&&>>,
+    (sizeof(T) > indirect_threshold)
+  >;
+
+  template<class It>
+  constexpr bool RandomAccessRange = concepts::BaseOf<
+    std::random_access_iterator_tag,
+    typename std::iterator_traits<It>::iterator_category
+  >;
+
+  struct identity
+  {
+    template<class T>
+    constexpr T&& operator ()(T &&value) const noexcept { return std::forward<T>(value); }
+  };
+
+  namespace detail
+  {
+
+    template<class It, class Proj>
+    using projected_t = traits::decay_t<std::invoke_result_t<Proj&, iterator::reference_t<It>>>;
+
+    // Keys small enough to copy are cached next to the index so comparisons
+    // never touch the (large) records themselves.
+    template<class Key>
+    constexpr bool CacheableKey = require<
+      concepts::TriviallyCopyable<Key>,
+      (sizeof(Key) <= 2 * sizeof(void*))
+    >;
+
+    // Moves every element to its sorted position exactly once, following each
+    // cycle of the permutation. order[i] is the source index for position i.
+    template<class It>
+    void apply_permutation(It first, std::vector<std::size_t> &order)
+    {
+      using value_t = iterator::value_type_t<It>;
+      const std::size_t n = order.size();
+
+      for (std::size_t start = 0; start < n; ++start)
+      {
+        if (order[start] == start)
+          continue;
+
+        value_t hold = std::move(first[start]);
+        std::size_t pos = start;
+        for (;;)
+        {
+          const std::size_t src = order[pos];
+          order[pos] = pos;
+          if (src == start)
+          {
+            first[pos] = std::move(hold);
+            break;
+          }
+          first[pos] = std::move(first[src]);
+          pos = src;
+        }
+      }
+    }
+
+    template<bool Stable, class It, class Comp, class Proj>
+    void indirect_sort(It first, It last, Comp &comp, Proj &proj)
+    {
+      using key_t = projected_t<It, Proj>;
+      const auto n = static_cast<std::size_t>(last - first);
+      std::vector<std::size_t> order(n);
+
+      if constexpr (CacheableKey<key_t>)
+      {
+        struct entry
+        {
+          key_t key;
+          std::size_t index;
+        };
+
+        std::vector<entry> keyed;
+        keyed.reserve(n);
+        for (std::size_t i = 0; i < n; ++i)
+          keyed.push_back({ std::invoke(proj, first[i]), i });
+
+        auto less = [&comp](const entry &a, const entry &b) { return std::invoke(comp, a.key, b.key); };
+        if constexpr (Stable)
+          std::stable_sort(keyed.begin(), keyed.end(), less);
+        else
+          std::sort(keyed.begin(), keyed.end(), less);
+
+        for (std::size_t i = 0; i < n; ++i)
+          order[i] = keyed[i].index;
+      }
+      else
+      {
+        for (std::size_t i = 0; i < n; ++i)
+          order[i] = i;
+
+        auto less = [&](std::size_t a, std::size_t b)
+        {
+          return std::invoke(comp, std::invoke(proj, first[a]), std::invoke(proj, first[b]));
+        };
+        if constexpr (Stable)
+          std::stable_sort(order.begin(), order.end(), less);
+        else
+          std::sort(order.begin(), order.end(), less);
+      }
+
+      apply_permutation(first, order);
+    }
+
+    template<bool Stable, class It, class Comp, class Proj>
+    void direct_sort(It first, It last, Comp &comp, Proj &proj)
+    {
+      auto less = [&](const auto &a, const auto &b)
+      {
+        return std::invoke(comp, std::invoke(proj, a), std::invoke(proj, b));
+      };
+      if constexpr (Stable)
+        std::stable_sort(first, last, less);
+      else
+        std::sort(first, last, less);
+    }
+
+  }
+
+  template<class It, class Comp = std::less<>, class Proj = identity>
+  void indirect_sort(It first, It last, Comp comp = { }, Proj proj = { })
+  {
+    static_assert(RandomAccessRange<It>, "indirect_sort requires random access iterators");
+    detail::indirect_sort<false>(first, last, comp, proj);
+  }
+
+  template<class It, class Comp = std::less<>, class Proj = identity>
+  void indirect_stable_sort(It first, It last, Comp comp = { }, Proj proj = { })
+  {
+    static_assert(RandomAccessRange<It>, "indirect_stable_sort requires random access iterators");
+    detail::indirect_sort<true>(first, last, comp, proj);
+  }
+
+  // Picks indirect sorting for expensive or throwing-move element types and
+  // falls back to std::sort otherwise.
+  template<class It, class Comp = std::less<>, class Proj = identity>
+  void sort(It first, It last, Comp comp = { }, Proj proj = { })
+  {
+    static_assert(RandomAccessRange<It>, "sorting::sort requires random access iterators");
+    if constexpr (PreferIndirect<iterator::value_type_t<It>>)
+      detail::indirect_sort<false>(first, last, comp, proj);
+    else
+      detail::direct_sort<false>(first, last, comp, proj);
+  }
+
+  template<class It, class Comp = std::less<>, class Proj = identity>
+  void stable_sort(It first, It last, Comp comp = { }, Proj proj = { })
+  {
+    static_assert(RandomAccessRange<It>, "sorting::stable_sort requires random access iterators");
+    if constexpr (PreferIndirect<iterator::value_type_t<It>>)
+      detail::indirect_sort<true>(first, last, comp, proj);
+    else
+      detail::direct_sort<true>(first, last, comp, proj);
+  }
+
+}
@@ -0,0 +1,336 @@
+#pragma once
+
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2019 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#if defined(__has_include)
+#if __has_include(<span>)
+#include <span>
+#endif
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#define CONCEPTS_STREAM_PREAD 1
+#endif
+
+#include "CoreConcepts.hpp"
+
+namespace stream
+{
+
+#if defined(__cpp_lib_span)
+  using chunk = std::span<const std::byte>;
+#else
+  class chunk
+  {
+  public:
+    constexpr chunk() noexcept = default;
+    constexpr chunk(const std::byte *data, std::size_t size) noexcept : m_data(data), m_size(size) { }
+
+    constexpr const std::byte* data() const noexcept { return m_data; }
+    constexpr std::size_t size() const noexcept { return m_size; }
+    constexpr bool empty() const noexcept { return m_size == 0; }
+
+    constexpr const std::byte* begin() const noexcept { return m_data; }
+    constexpr const std::byte* end() const noexcept { return m_data + m_size; }
+
+    constexpr const std::byte& operator[](std::size_t idx) const noexcept { return m_data[idx]; }
+
+  private:
+    const std::byte *m_data = nullptr;
+    std::size_t m_size = 0;
+  };
+#endif
+
+  struct reader_options
+  {
+    std::size_t chunk_size = std::size_t(1) << 20;
+    std::size_t alignment = 4096;
+  };
+
+  namespace detail
+  {
+
+    struct aligned_delete
+    {
+      std::align_val_t alignment;
+
+      void operator ()(std::byte *ptr) const noexcept
+      {
+        ::operator delete(ptr, alignment);
+      }
+    };
+
+    using aligned_buffer = std::unique_ptr<std::byte[], aligned_delete>;
+
+    inline aligned_buffer make_aligned_buffer(std::size_t size, std::size_t alignment)
+    {
+      const auto align = static_cast<std::align_val_t>(alignment);
+      return aligned_buffer(static_cast<std::byte*>(::operator new(size, align)), aligned_delete{ align });
+    }
+
+#if defined(CONCEPTS_STREAM_PREAD)
+    class file_source
+    {
+    public:
+      explicit file_source(const std::string &path) : m_fd(::open(path.c_str(), O_RDONLY))
+      {
+        if (m_fd < 0)
+          throw std::system_error(errno, std::generic_category(), "stream: cannot open " + path);
+#if defined(POSIX_FADV_SEQUENTIAL)
+        ::posix_fadvise(m_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+      }
+
+      file_source(const file_source &) = delete;
+      file_source& operator =(const file_source &) = delete;
+
+      ~file_source() { ::close(m_fd); }
+
+      // Fills as much of [buffer, buffer + size) as the file allows; short only at EOF.
+      std::size_t read(std::byte *buffer, std::size_t size)
+      {
+        std::size_t total = 0;
+        while (total < size)
+        {
+          const ::ssize_t got = ::pread(m_fd, buffer + total, size - total, static_cast<::off_t>(m_offset));
+          if (got < 0)
+          {
+            if (errno == EINTR)
+              continue;
+            throw std::system_error(errno, std::generic_category(), "stream: read failed");
+          }
+          if (got == 0)
+            break;
+
+          total += static_cast<std::size_t>(got);
+          m_offset += static_cast<std::uint64_t>(got);
+        }
+        return total;
+      }
+
+    private:
+      int m_fd;
+      std::uint64_t m_offset = 0;
+    };
+#else
+    class file_source
+    {
+    public:
+      explicit file_source(const std::string &path) : m_file(std::fopen(path.c_str(), "rb"))
+      {
+        if (!m_file)
+          throw std::system_error(errno, std::generic_category(), "stream: cannot open " + path);
+        std::setvbuf(m_file, nullptr, _IONBF, 0);
+      }
+
+      file_source(const file_source &) = delete;
+      file_source& operator =(const file_source &) = delete;
+
+      ~file_source() { std::fclose(m_file); }
+
+      std::size_t read(std::byte *buffer, std::size_t size)
+      {
+        const std::size_t got = std::fread(buffer, 1, size, m_file);
+        if (got < size && std::ferror(m_file))
+          throw std::system_error(errno, std::generic_category(), "stream: read failed");
+        return got;
+      }
+
+    private:
+      std::FILE *m_file;
+    };
+#endif
+
+    // Two buffers handed back and forth between the reader thread and the consumer.
+    class double_buffer
+    {
+    public:
+      double_buffer(std::size_t size, std::size_t alignment)
+      {
+        for (auto &s : m_slots)
+          s.data = make_aligned_buffer(size, alignment);
+      }
+
+      struct slot
+      {
+        aligned_buffer data;
+        std::size_t size = 0;
+        bool full = false;
+        bool last = false;
+        std::exception_ptr error;
+      };
+
+      slot& acquire_empty(std::size_t idx)
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [&] { return m_cancelled || !m_slots[idx].full; });
+        return m_slots[idx];
+      }
+
+      slot& acquire_full(std::size_t idx)
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [&] { return m_slots[idx].full; });
+        return m_slots[idx];
+      }
+
+      void publish(std::size_t idx)
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_slots[idx].full = true;
+        m_cv.notify_all();
+      }
+
+      void release(std::size_t idx)
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_slots[idx].full = false;
+        m_cv.notify_all();
+      }
+
+      void cancel()
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_cancelled = true;
+        m_cv.notify_all();
+      }
+
+      bool cancelled()
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_cancelled;
+      }
+
+    private:
+      std::mutex m_mutex;
+      std::condition_variable m_cv;
+      slot m_slots[2];
+      bool m_cancelled = false;
+    };
+
+    inline void fill_buffers(file_source &source, double_buffer &buffers, std::size_t chunk_size)
+    {
+      for (std::size_t idx = 0;; idx ^= 1)
+      {
+        auto &s = buffers.acquire_empty(idx);
+        if (buffers.cancelled())
+          return;
+
+        try
+        {
+          s.size = source.read(s.data.get(), chunk_size);
+          s.last = s.size < chunk_size;
+        }
+        catch (...)
+        {
+          s.size = 0;
+          s.last = true;
+          s.error = std::current_exception();
+        }
+
+        const bool last = s.last;
+        buffers.publish(idx);
+        if (last)
+          return;
+      }
+    }
+
+  }
+
+  // Streams the file at `path` through `consumer` one chunk at a time. A background
+  // thread reads the next chunk while the consumer works on the current one.
+  // Returns the number of bytes delivered. Throws std::invalid_argument if
+  // options.alignment is neither 0 nor a power of two.
+  template<class F>
+  std::uint64_t read_chunks(const std::string &path, F &&consumer, reader_options options = { })
+  {
+    static_assert(Invocable<traits::remove_reference_t<F>&, chunk>, "read_chunks requires a consumer invocable with stream::chunk");
+
+    if (options.alignment & (options.alignment - 1))
+      throw std::invalid_argument("stream: alignment must be a power of two");
+
+    const std::size_t alignment = options.alignment ? options.alignment : alignof(std::max_align_t);
+    const std::size_t chunk_size = ((std::max<std::size_t>(options.chunk_size, 1) + alignment - 1) / alignment) * alignment;
+
+    detail::file_source source(path);
+    detail::double_buffer buffers(chunk_size, alignment);
+    std::thread reader([&] { detail::fill_buffers(source, buffers, chunk_size); });
+
+    std::uint64_t total = 0;
+    try
+    {
+      for (std::size_t idx = 0;; idx ^= 1)
+      {
+        auto &s = buffers.acquire_full(idx);
+        if (s.error)
+          std::rethrow_exception(s.error);
+
+        if (s.size)
+          std::invoke(consumer, chunk(s.data.get(), s.size));
+        total += s.size;
+
+        const bool last = s.last;
+        buffers.release(idx);
+        if (last)
+          break;
+      }
+    }
+    catch (...)
+    {
+      buffers.cancel();
+      reader.join();
+      throw;
+    }
+
+    reader.join();
+    return total;
+  }
+
+}
@@ -0,0 +1,559 @@
+#pragma once
+
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2019 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include "CoreConcepts.hpp"
+
+#if !defined(__cpp_impl_coroutine)
+#error "Task.hpp requires a compiler with C++20 coroutine support"
+#endif
+
+#include <algorithm>
+#include <cassert>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace coro
+{
+
+  template<class T>
+  constexpr bool Awaiter = ::Awaiter<T, std::coroutine_handle<>>;
+
+  template<class T>
+  constexpr bool Awaitable = ::Awaitable<T, std::coroutine_handle<>>;
+
+  namespace detail
+  {
+
+    // Coroutine frames are recycled through per-thread, size-classed free lists
+    // so a steady stream of short-lived tasks stops hitting the global heap.
+    class frame_pool
+    {
+    public:
+      static constexpr std::size_t granularity = 64;
+      static constexpr std::size_t classes = 16;
+      static constexpr std::size_t max_cached = 256;
+
+      static void* allocate(std::size_t size)
+      {
+        const std::size_t index = size_class(size);
+        if (index >= classes)
+          return ::operator new(size);
+
+        bin &b = local().bins[index];
+        if (b.head)
+        {
+          block *blk = b.head;
+          b.head = blk->next;
+          --b.count;
+          return blk;
+        }
+
+        return ::operator new((index + 1) * granularity);
+      }
+
+      static void deallocate(void *ptr, std::size_t size) noexcept
+      {
+        const std::size_t index = size_class(size);
+        if (index >= classes)
+        {
+          ::operator delete(ptr);
+          return;
+        }
+
+        bin &b = local().bins[index];
+        if (b.count >= max_cached)
+        {
+          ::operator delete(ptr);
+          return;
+        }
+
+        block *blk = static_cast<block*>(ptr);
+        blk->next = b.head;
+        b.head = blk;
+        ++b.count;
+      }
+
+    private:
+      struct block
+      {
+        block *next;
+      };
+
+      struct bin
+      {
+        block *head = nullptr;
+        std::size_t count = 0;
+      };
+
+      struct cache
+      {
+        bin bins[classes];
+
+        ~cache()
+        {
+          for (bin &b : bins)
+          {
+            while (b.head)
+              ::operator delete(std::exchange(b.head, b.head->next));
+          }
+        }
+      };
+
+      static std::size_t size_class(std::size_t size) noexcept
+      {
+        return size == 0 ? 0 : (size - 1) / granularity;
+      }
+
+      static cache& local() noexcept
+      {
+        thread_local cache c;
+        return c;
+      }
+    };
+
+    struct pooled_frame
+    {
+      static void* operator new(std::size_t size)
+      {
+        return frame_pool::allocate(size);
+      }
+
+      static void operator delete(void *ptr, std::size_t size) noexcept
+      {
+        frame_pool::deallocate(ptr, size);
+      }
+    };
+
+    struct promise_base : pooled_frame
+    {
+      struct final_awaiter
+      {
+        bool await_ready() const noexcept { return false; }
+
+        template<class Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+        {
+          if (auto continuation = handle.promise().continuation)
+            return continuation;
+          return std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept { }
+      };
+
+      std::suspend_always initial_suspend() const noexcept { return { }; }
+      final_awaiter final_suspend() const noexcept { return { }; }
+
+      void unhandled_exception() noexcept { exception = std::current_exception(); }
+
+      void rethrow_if_exception()
+      {
+        if (exception)
+          std::rethrow_exception(exception);
+      }
+
+      std::coroutine_handle<> continuation;
+      std::exception_ptr exception;
+    };
+
+  }
+
+  template<class T = void>
+  class task;
+
+  namespace detail
+  {
+
+    template<class T>
+    struct promise : promise_base
+    {
+      task<T> get_return_object() noexcept;
+
+      template<class U, class = std::enable_if_t<concepts::Convertible<U&&, T>>>
+      void return_value(U &&value)
+      {
+        result.emplace(std::forward<U>(value));
+      }
+
+      T get()
+      {
+        rethrow_if_exception();
+        return std::move(*result);
+      }
+
+      std::optional<T> result;
+    };
+
+    template<>
+    struct promise<void> : promise_base
+    {
+      task<void> get_return_object() noexcept;
+
+      void return_void() noexcept { }
+
+      void get()
+      {
+        rethrow_if_exception();
+      }
+    };
+
+  }
+
+  template<class T>
+  class task
+  {
+  public:
+    static_assert(disallow<concepts::Reference<T>>, "task<T> does not support reference results");
+
+    using promise_type = detail::promise<T>;
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    struct awaiter
+    {
+      bool await_ready() const noexcept
+      {
+        assert(handle && "awaiting an empty or moved-from task");
+        return handle.done();
+      }
+
+      std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+      {
+        handle.promise().continuation = awaiting;
+        return handle;
+      }
+
+      T await_resume() { return handle.promise().get(); }
+
+      handle_type handle;
+    };
+
+    struct ready_awaiter : awaiter
+    {
+      void await_resume() const noexcept { }
+    };
+
+    task() noexcept = default;
+    explicit task(handle_type handle) noexcept : m_handle(handle) { }
+
+    task(task &&other) noexcept : m_handle(std::exchange(other.m_handle, { })) { }
+
+    task& operator =(task &&other) noexcept
+    {
+      if (this != &other)
+      {
+        reset();
+        m_handle = std::exchange(other.m_handle, { });
+      }
+      return *this;
+    }
+
+    task(const task &) = delete;
+    task& operator =(const task &) = delete;
+
+    ~task() { reset(); }
+
+    bool valid() const noexcept { return static_cast<bool>(m_handle); }
+    bool done() const noexcept { return !m_handle || m_handle.done(); }
+
+    awaiter operator co_await() && noexcept { return awaiter{ m_handle }; }
+
+    // Waits for completion without consuming the result or rethrowing.
+    ready_awaiter when_ready() const noexcept { return ready_awaiter{ { m_handle } }; }
+
+    T result()
+    {
+      assert(m_handle && "result() of an empty or moved-from task");
+      return m_handle.promise().get();
+    }
+
+  private:
+    void reset() noexcept
+    {
+      if (m_handle)
+        std::exchange(m_handle, { }).destroy();
+    }
+
+    handle_type m_handle;
+  };
+
+  namespace detail
+  {
+
+    template<class T>
+    task<T> promise<T>::get_return_object() noexcept
+    {
+      return task<T>{ std::coroutine_handle<promise<T>>::from_promise(*this) };
+    }
+
+    inline task<void> promise<void>::get_return_object() noexcept
+    {
+      return task<void>{ std::coroutine_handle<promise<void>>::from_promise(*this) };
+    }
+
+    class event
+    {
+    public:
+      void set()
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_set = true;
+        m_cv.notify_all();
+      }
+
+      void wait()
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this] { return m_set; });
+      }
+
+    private:
+      std::mutex m_mutex;
+      std::condition_variable m_cv;
+      bool m_set = false;
+    };
+
+    class sync_wait_task
+    {
+    public:
+      struct promise_type : pooled_frame
+      {
+        struct notifier
+        {
+          bool await_ready() const noexcept { return false; }
+
+          void await_suspend(std::coroutine_handle<promise_type> handle) noexcept
+          {
+            handle.promise().done->set();
+          }
+
+          void await_resume() const noexcept { }
+        };
+
+        sync_wait_task get_return_object() noexcept
+        {
+          return sync_wait_task{ std::coroutine_handle<promise_type>::from_promise(*this) };
+        }
+
+        std::suspend_always initial_suspend() const noexcept { return { }; }
+        notifier final_suspend() const noexcept { return { }; }
+
+        void return_void() noexcept { }
+        void unhandled_exception() noexcept { std::terminate(); }
+
+        event *done = nullptr;
+      };
+
+      explicit sync_wait_task(std::coroutine_handle<promise_type> handle) noexcept : m_handle(handle) { }
+      sync_wait_task(sync_wait_task &&other) noexcept : m_handle(std::exchange(other.m_handle, { })) { }
+      ~sync_wait_task() { if (m_handle) m_handle.destroy(); }
+
+      void run(event &done)
+      {
+        m_handle.promise().done = &done;
+        m_handle.resume();
+        done.wait();
+      }
+
+    private:
+      std::coroutine_handle<promise_type> m_handle;
+    };
+
+    template<class T>
+    sync_wait_task make_sync_wait_task(task<T> &t)
+    {
+      co_await t.when_ready();
+    }
+
+    struct detached_task
+    {
+      struct promise_type : pooled_frame
+      {
+        detached_task get_return_object() noexcept { return { }; }
+
+        std::suspend_never initial_suspend() const noexcept { return { }; }
+        std::suspend_never final_suspend() const noexcept { return { }; }
+
+        void return_void() noexcept { }
+        void unhandled_exception() noexcept { std::terminate(); }
+      };
+    };
+
+    template<class Executor>
+    detached_task spawn_detached(Executor &executor, task<void> t)
+    {
+      co_await executor.schedule();
+      co_await std::move(t);
+    }
+
+    template<class E>
+    using schedule = decltype(std::declval<E&>().schedule());
+
+  }
+
+  template<class E>
+  constexpr bool Executor = require<
+    Awaitable<detected_t<detail::schedule, E>>
+  >;
+
+  // Blocks the calling thread until the task has completed, wherever it ran.
+  template<class T>
+  T sync_wait(task<T> t)
+  {
+    assert(t.valid() && "sync_wait on an empty or moved-from task");
+    detail::event done;
+    detail::make_sync_wait_task(t).run(done);
+    return t.result();
+  }
+
+  template<class Exec>
+  struct schedule_awaiter
+  {
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> handle) { executor.post(handle); }
+    void await_resume() const noexcept { }
+
+    Exec &executor;
+  };
+
+  // Runs posted coroutines on whichever thread calls run() / run_one().
+  class single_thread_executor
+  {
+  public:
+    schedule_awaiter<single_thread_executor> schedule() noexcept { return { *this }; }
+
+    void post(std::coroutine_handle<> handle)
+    {
+      m_ready.push_back(handle);
+    }
+
+    bool run_one()
+    {
+      if (m_ready.empty())
+        return false;
+
+      auto handle = m_ready.front();
+      m_ready.pop_front();
+      handle.resume();
+      return true;
+    }
+
+    void run()
+    {
+      while (run_one());
+    }
+
+  private:
+    std::deque<std::coroutine_handle<>> m_ready;
+  };
+
+  class thread_pool_executor
+  {
+  public:
+    explicit thread_pool_executor(std::size_t threads = std::thread::hardware_concurrency())
+    {
+      threads = std::max<std::size_t>(threads, 1);
+      m_threads.reserve(threads);
+      for (std::size_t i = 0; i < threads; ++i)
+        m_threads.emplace_back([this] { worker(); });
+    }
+
+    thread_pool_executor(const thread_pool_executor &) = delete;
+    thread_pool_executor& operator =(const thread_pool_executor &) = delete;
+
+    ~thread_pool_executor()
+    {
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+      }
+      m_cv.notify_all();
+      for (auto &thread : m_threads)
+        thread.join();
+    }
+
+    schedule_awaiter<thread_pool_executor> schedule() noexcept { return { *this }; }
+
+    void post(std::coroutine_handle<> handle)
+    {
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_ready.push_back(handle);
+      }
+      m_cv.notify_one();
+    }
+
+    std::size_t size() const noexcept { return m_threads.size(); }
+
+  private:
+    void worker()
+    {
+      for (;;)
+      {
+        std::coroutine_handle<> handle;
+        {
+          std::unique_lock<std::mutex> lock(m_mutex);
+          m_cv.wait(lock, [this] { return m_stop || !m_ready.empty(); });
+          if (m_ready.empty())
+            return;
+
+          handle = m_ready.front();
+          m_ready.pop_front();
+        }
+        handle.resume();
+      }
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<std::coroutine_handle<>> m_ready;
+    std::vector<std::thread> m_threads;
+    bool m_stop = false;
+  };
+
+  // Starts a fire-and-forget task on the executor; the frame frees itself on completion.
+  template<class Exec>
+  void spawn(Exec &executor, task<void> t)
+  {
+    static_assert(Executor<Exec>, "spawn requires an executor with an awaitable schedule()");
+    detail::spawn_detached(executor, std::move(t));
+  }
+
+}
@@ -30,25 +30,8 @@
 //
 ////////////////////////////////////////////////////////////
 
+#include <cstddef>
 #include <type_traits>
-#include <iterator>
-
-namespace iterator
-{
-
-  template<class Iter>
-  using difference_type_t = typename std::iterator_traits<Iter>::difference_type;
-
-  template<class Iter>
-  using value_type_t = typename std::iterator_traits<Iter>::value_type;
-
-  template<class Iter>
-  using pointer_t = typename std::iterator_traits<Iter>::pointer;
-
-  template<class Iter>
-  using reference_t = typename std::iterator_traits<Iter>::reference;
-
-}
 
 namespace traits
 {
@@ -105,6 +88,9 @@ namespace traits
   template<class T> using add_lvalue_reference_t = typename add_lvalue_reference<T>::type;
   template<class T> using add_rvalue_reference_t = typename add_rvalue_reference<T>::type;
 
+  // const T& for any T, without forming a reference to void.
+  template<class T> using const_lvalue_reference_t = add_lvalue_reference_t<const remove_reference_t<T>>;
+
   template<class T> struct remove_pointer { using type = T; };
   template<class T> struct remove_pointer<T*> { using type = T; };
   template<class T> struct remove_pointer<T* const> { using type = T; };
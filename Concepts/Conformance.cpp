@@ -0,0 +1,552 @@
+// Conformance matrix: every concept in Concepts.hpp and Detail.hpp checked
+// against the C++20 standard library over ordinary and adversarial types.
+//
+// Needs C++20 (/std:c++latest, -std=c++20). Each CONFORMANCE_* line below is
+// one row; conformance_timing.py compiles the rows one at a time to record
+// their compile time and peak memory. A failing cell names the concept, the
+// type(s) and both answers in the static_assert.
+
+#include <concepts>
+#include <cstddef>
+#include <deque>
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if !defined(__cpp_lib_concepts)
+#error "Conformance.cpp compares against <concepts> and needs C++20"
+#endif
+
+#if defined(__cpp_impl_coroutine)
+#include <coroutine>
+#endif
+
+// The matrix probes ++, -- and += on volatile int, which C++20 deprecates.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wvolatile"
+#endif
+
+#include "Concepts/Concepts.hpp"
+
+namespace conformance
+{
+
+  template<class ...T>
+  struct types { };
+
+  template<class T, bool Ours, bool Std>
+  struct agree
+  {
+    static_assert(Ours == Std, "concept disagrees with the standard for T");
+    static constexpr bool value = Ours == Std;
+  };
+
+  template<class T, class U, bool Ours, bool Std>
+  struct agree_with
+  {
+    static_assert(Ours == Std, "concept disagrees with the standard for (T, U)");
+    static constexpr bool value = Ours == Std;
+  };
+
+  enum plain_enum { plain_value };
+  enum class scoped_enum { value };
+
+  struct empty { };
+  struct aggregate { int i; double d; };
+  struct padded { char c; int i; };
+  struct base { };
+  struct derived : base { };
+  struct private_derived : private base { };
+  struct abstract { virtual void f() = 0; };
+
+  struct move_only
+  {
+    move_only() = default;
+    move_only(move_only&&) = default;
+    move_only& operator =(move_only&&) = default;
+  };
+
+  struct non_movable
+  {
+    non_movable() = default;
+    non_movable(const non_movable&) = delete;
+    non_movable& operator =(const non_movable&) = delete;
+  };
+
+  struct throwing_move
+  {
+    throwing_move() = default;
+    throwing_move(throwing_move&&) noexcept(false) { }
+    throwing_move& operator =(throwing_move&&) noexcept(false) { return *this; }
+  };
+
+  struct throwing_dtor { ~throwing_dtor() noexcept(false) { } };
+  struct private_dtor { private: ~private_dtor() = default; };
+  struct no_default { explicit no_default(int) { } };
+
+  struct explicit_copy
+  {
+    explicit_copy() = default;
+    explicit explicit_copy(const explicit_copy&) = default;
+    explicit_copy& operator =(const explicit_copy&) = default;
+  };
+
+  struct void_assign
+  {
+    void_assign() = default;
+    void_assign(const void_assign&) = default;
+    void operator =(const void_assign&) { }
+  };
+
+  struct int_assign
+  {
+    int_assign& operator =(int) { return *this; }
+  };
+
+  struct adl_swap
+  {
+    adl_swap() = default;
+    adl_swap(const adl_swap&) = delete;
+    adl_swap& operator =(const adl_swap&) = delete;
+    friend void swap(adl_swap&, adl_swap&) { }
+  };
+
+  struct regular
+  {
+    int v;
+    friend bool operator ==(const regular&, const regular&) = default;
+  };
+
+  struct ordered
+  {
+    int v;
+    auto operator <=>(const ordered&) const = default;
+  };
+
+  struct explicit_bool
+  {
+    explicit operator bool() const { return true; }
+  };
+
+  struct int_equality
+  {
+    friend int operator ==(int_equality, int_equality) { return 1; }
+    friend int operator !=(int_equality, int_equality) { return 0; }
+  };
+
+  struct explicit_bool_equality
+  {
+    friend explicit_bool operator ==(explicit_bool_equality, explicit_bool_equality) { return { }; }
+    friend explicit_bool operator !=(explicit_bool_equality, explicit_bool_equality) { return { }; }
+  };
+
+  struct void_equality
+  {
+    friend void operator ==(void_equality, void_equality) { }
+  };
+
+  struct deleted_inequality
+  {
+    friend bool operator ==(deleted_inequality, deleted_inequality) { return true; }
+    friend bool operator !=(deleted_inequality, deleted_inequality) = delete;
+  };
+
+  struct callable { void operator ()() { } };
+  struct const_predicate { bool operator ()() const { return true; } };
+  struct int_predicate { int operator ()(int) const { return 0; } };
+  struct rvalue_callable { bool operator ()() && { return true; } };
+  struct lvalue_callable { bool operator ()() & { return true; } };
+  struct explicit_bool_callable { explicit_bool operator ()() const { return { }; } };
+
+  // operator * returns a prvalue: readable, never writable.
+  struct prvalue_iterator
+  {
+    using value_type = int;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::input_iterator_tag;
+
+    int operator *() const;
+    prvalue_iterator& operator ++();
+    prvalue_iterator operator ++(int);
+    friend bool operator ==(const prvalue_iterator&, const prvalue_iterator&);
+  };
+
+  struct move_only_iterator
+  {
+    using value_type = int;
+    using difference_type = std::ptrdiff_t;
+    using iterator_concept = std::input_iterator_tag;
+
+    move_only_iterator(move_only_iterator&&) = default;
+    move_only_iterator& operator =(move_only_iterator&&) = default;
+
+    int& operator *() const;
+    move_only_iterator& operator ++();
+    void operator ++(int);
+  };
+
+  // No tag at all, so ITER_CONCEPT falls back to random access.
+  struct untagged_iterator
+  {
+    using value_type = int;
+    using difference_type = std::ptrdiff_t;
+
+    int& operator *() const;
+    untagged_iterator& operator ++();
+    untagged_iterator operator ++(int);
+    friend bool operator ==(const untagged_iterator&, const untagged_iterator&);
+  };
+
+  struct void_postfix_iterator
+  {
+    using value_type = int;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::forward_iterator_tag;
+
+    int& operator *() const;
+    void_postfix_iterator& operator ++();
+    void operator ++(int);
+    friend bool operator ==(const void_postfix_iterator&, const void_postfix_iterator&);
+  };
+
+  struct void_dereference_iterator
+  {
+    using value_type = int;
+    using difference_type = std::ptrdiff_t;
+
+    void operator *() const;
+    void_dereference_iterator& operator ++();
+    void_dereference_iterator operator ++(int);
+  };
+
+  struct no_difference_iterator
+  {
+    using value_type = int;
+
+    int& operator *() const;
+    no_difference_iterator& operator ++();
+    no_difference_iterator operator ++(int);
+  };
+
+  using values = types<
+    void, int, const int, volatile int, int&, const int&, int&&,
+    int*, const int*, void*, int[3], int[], void(), void(*)(), int empty::*, void (empty::*)(),
+    std::nullptr_t, bool, char, unsigned, long long, float, double, plain_enum, scoped_enum,
+    std::string, std::vector<int>, std::unique_ptr<int>, std::shared_ptr<int>, std::optional<int>, std::mutex,
+    empty, aggregate, padded, base, derived, private_derived, abstract,
+    move_only, non_movable, throwing_move, throwing_dtor, private_dtor, no_default, explicit_copy,
+    void_assign, int_assign, adl_swap, regular, ordered, explicit_bool,
+    int_equality, explicit_bool_equality, void_equality, deleted_inequality
+  >;
+
+  using iterators = types<
+    int, int*, const int*, void*, int* const, int*&, std::unique_ptr<int>, std::optional<int>,
+    std::vector<int>::iterator, std::vector<int>::const_iterator, std::vector<bool>::iterator,
+    std::deque<int>::iterator, std::list<int>::iterator, std::forward_list<int>::iterator,
+    std::map<int, int>::iterator, std::istream_iterator<int>, std::istreambuf_iterator<char>,
+    std::ostream_iterator<int>, std::back_insert_iterator<std::vector<int>>,
+    std::reverse_iterator<int*>, std::move_iterator<int*>, std::move_iterator<std::list<int>::iterator>,
+    prvalue_iterator, move_only_iterator, untagged_iterator, void_postfix_iterator,
+    void_dereference_iterator, no_difference_iterator
+  >;
+
+  using callables = types<
+    void, int, callable, const_predicate, int_predicate, rvalue_callable, lvalue_callable,
+    explicit_bool_callable, callable&, const const_predicate&, rvalue_callable&, lvalue_callable&&,
+    bool(), bool(&)(), bool(*)(), void(*)(), int(*)(int), int empty::*, bool (empty::*)()
+  >;
+
+  using operands = types<
+    void, int, const int, int&, const int&, int&&, long, double, bool, int*, const int*,
+    std::string, const char*, base, derived, private_derived, int_assign, explicit_copy, move_only, regular
+  >;
+
+  using sentinels = types<
+    int, int*, const int*, std::vector<int>::iterator, std::vector<int>::const_iterator,
+    std::list<int>::iterator, std::istream_iterator<int>, std::default_sentinel_t,
+    std::unreachable_sentinel_t, untagged_iterator, move_only_iterator
+  >;
+
+  using writables = types<int, const int&, int&&, long, double, bool, std::string, const char*>;
+
+  using outputs = types<
+    int, int*, const int*, void*, std::vector<int>::iterator, std::vector<int>::const_iterator,
+    std::vector<bool>::iterator, std::ostream_iterator<int>, std::back_insert_iterator<std::vector<int>>,
+    std::unique_ptr<int>, std::string*, prvalue_iterator, untagged_iterator
+  >;
+
+  // Exposition-only or non-standard concepts, restated with requires clauses.
+  template<class T>
+  concept boolean_testable = std::convertible_to<T, bool> && requires(T &&t)
+  {
+    { !std::forward<T>(t) } -> std::convertible_to<bool>;
+  };
+
+  template<class T, class U>
+  concept weakly_equality_comparable_with = requires(const std::remove_reference_t<T> &t, const std::remove_reference_t<U> &u)
+  {
+    { t == u } -> boolean_testable;
+    { t != u } -> boolean_testable;
+    { u == t } -> boolean_testable;
+    { u != t } -> boolean_testable;
+  };
+
+  template<class T, class U>
+  concept partially_ordered_with = requires(const std::remove_reference_t<T> &t, const std::remove_reference_t<U> &u)
+  {
+    { t < u } -> boolean_testable;
+    { t > u } -> boolean_testable;
+    { t <= u } -> boolean_testable;
+    { t >= u } -> boolean_testable;
+    { u < t } -> boolean_testable;
+    { u > t } -> boolean_testable;
+    { u <= t } -> boolean_testable;
+    { u >= t } -> boolean_testable;
+  };
+
+  template<class T>
+  concept weakly_decrementable = std::movable<T> && requires(T i)
+  {
+    { --i } -> std::same_as<T&>;
+  };
+
+  template<class T>
+  concept decrementable = std::regular<T> && weakly_decrementable<T> && requires(T i)
+  {
+    { i-- } -> std::same_as<T>;
+  };
+
+  template<class T>
+  concept copy_assignable = requires(T &a, const T &b) { { a = b } -> std::same_as<T&>; };
+
+  template<class T>
+  concept move_assignable = requires(T &a, T &&b) { { a = std::move(b) } -> std::same_as<T&>; };
+
+  template<class T>
+  concept bitwise_comparable = std::is_trivially_copyable_v<T> && std::has_unique_object_representations_v<T>;
+
+  template<class T, class U>
+  constexpr bool derived_from = std::derived_from<U, T>;
+
+  template<class T>
+  constexpr bool invocable_with_int = std::invocable<T, int>;
+
+  template<class T>
+  constexpr bool predicate_with_int = std::predicate<T, int>;
+
+  template<class T>
+  constexpr bool ours_invocable_with_int = Invocable<T, int>;
+
+  template<class T>
+  constexpr bool ours_predicate_with_int = Predicate<T, int>;
+
+  template<class T, class U>
+  constexpr bool ours_constructable_from = Constructable<T, U>;
+
+  template<class T, class U>
+  constexpr bool std_constructible_from = std::constructible_from<T, U>;
+
+  template<class T, class U>
+  constexpr bool detail_constructable_from = concepts::Constructable<T, U>;
+
+  template<class T, class U>
+  constexpr bool std_is_constructible = std::is_constructible_v<T, U>;
+
+#if defined(__cpp_impl_coroutine)
+  struct bool_awaiter
+  {
+    bool await_ready() const { return false; }
+    bool await_suspend(std::coroutine_handle<>) { return false; }
+    int await_resume() { return 0; }
+  };
+
+  struct handle_awaiter
+  {
+    bool await_ready() const { return false; }
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> h) { return h; }
+    void await_resume() { }
+  };
+
+  struct int_suspend_awaiter
+  {
+    bool await_ready() const { return false; }
+    int await_suspend(std::coroutine_handle<>) { return 0; }
+    void await_resume() { }
+  };
+
+  struct no_resume_awaiter
+  {
+    bool await_ready() const { return false; }
+    void await_suspend(std::coroutine_handle<>) { }
+  };
+
+  struct member_awaitable
+  {
+    std::suspend_always operator co_await() const { return { }; }
+  };
+
+  struct free_awaitable { };
+  inline handle_awaiter operator co_await(free_awaitable) { return { }; }
+
+  using awaitables = types<
+    int, empty, std::suspend_always, std::suspend_never, bool_awaiter, handle_awaiter,
+    int_suspend_awaiter, no_resume_awaiter, member_awaitable, free_awaitable
+  >;
+
+  template<class R>
+  constexpr bool suspend_result = std::same_as<R, void> || std::same_as<R, bool> || std::convertible_to<R, std::coroutine_handle<>>;
+
+  template<class T>
+  concept awaiter = requires(T &a, std::coroutine_handle<> h)
+  {
+    { a.await_ready() } -> std::convertible_to<bool>;
+    a.await_resume();
+    requires suspend_result<decltype(a.await_suspend(h))>;
+  };
+
+  template<class T>
+  concept awaitable = awaiter<T>
+    || requires(T &&t) { { std::forward<T>(t).operator co_await() } -> awaiter; }
+    || requires(T &&t) { { operator co_await(std::forward<T>(t)) } -> awaiter; };
+
+  template<class T>
+  constexpr bool ours_awaiter = Awaiter<T, std::coroutine_handle<>>;
+
+  template<class T>
+  constexpr bool ours_awaitable = Awaitable<T, std::coroutine_handle<>>;
+#endif
+
+}
+
+#define CONFORMANCE_UNARY(Name, Ours, Std, Types)                                           \
+  template<class ...T>                                                                      \
+  constexpr bool conform_##Name(conformance::types<T...>)                                   \
+  {                                                                                         \
+    return (conformance::agree<T, Ours<T>, Std<T>>::value && ...);                          \
+  }                                                                                         \
+  static_assert(conform_##Name(conformance::Types{ }), #Ours " disagrees with " #Std)
+
+#define CONFORMANCE_BINARY(Name, Ours, Std, Lhs, Rhs)                                       \
+  template<class T, class ...U>                                                             \
+  constexpr bool conform_row_##Name(conformance::types<U...>)                               \
+  {                                                                                         \
+    return (conformance::agree_with<T, U, Ours<T, U>, Std<T, U>>::value && ...);            \
+  }                                                                                         \
+  template<class ...T>                                                                      \
+  constexpr bool conform_##Name(conformance::types<T...>)                                   \
+  {                                                                                         \
+    return (conform_row_##Name<T>(conformance::Rhs{ }) && ...);                             \
+  }                                                                                         \
+  static_assert(conform_##Name(conformance::Lhs{ }), #Ours " disagrees with " #Std)
+
+// rows
+
+CONFORMANCE_UNARY(destructable, Destructable, std::destructible, values);
+CONFORMANCE_UNARY(constructable, Constructable, std::constructible_from, values);
+CONFORMANCE_UNARY(default_constructable, DefaultConstructable, std::default_initializable, values);
+CONFORMANCE_UNARY(move_constructable, MoveConstructable, std::move_constructible, values);
+CONFORMANCE_UNARY(copy_constructable, CopyConstructable, std::copy_constructible, values);
+CONFORMANCE_UNARY(swappable, Swappable, std::swappable, values);
+CONFORMANCE_UNARY(moveable, Moveable, std::movable, values);
+CONFORMANCE_UNARY(copyable, Copyable, std::copyable, values);
+CONFORMANCE_UNARY(semiregular, Semiregular, std::semiregular, values);
+CONFORMANCE_UNARY(regular, Regular, std::regular, values);
+CONFORMANCE_UNARY(boolean, Boolean, conformance::boolean_testable, values);
+CONFORMANCE_UNARY(equality_comparable, EqualityComparable, std::equality_comparable, values);
+CONFORMANCE_UNARY(totally_ordered, TotallyOrdered, std::totally_ordered, values);
+CONFORMANCE_UNARY(integral, Integral, std::integral, values);
+CONFORMANCE_UNARY(signed_integral, SignedIntegral, std::signed_integral, values);
+CONFORMANCE_UNARY(unsigned_integral, UnsignedIntegral, std::unsigned_integral, values);
+CONFORMANCE_UNARY(floating_point, FloatingPoint, std::floating_point, values);
+CONFORMANCE_UNARY(pointer, Pointer, std::is_pointer_v, values);
+CONFORMANCE_UNARY(bitwise_comparable, BitwiseComparable, conformance::bitwise_comparable, values);
+CONFORMANCE_UNARY(invocable, Invocable, std::invocable, callables);
+CONFORMANCE_UNARY(invocable_with_int, conformance::ours_invocable_with_int, conformance::invocable_with_int, callables);
+CONFORMANCE_UNARY(predicate, Predicate, std::predicate, callables);
+CONFORMANCE_UNARY(predicate_with_int, conformance::ours_predicate_with_int, conformance::predicate_with_int, callables);
+CONFORMANCE_UNARY(weakly_incrementable, WeaklyIncrementable, std::weakly_incrementable, iterators);
+CONFORMANCE_UNARY(incrementable, Incrementable, std::incrementable, iterators);
+CONFORMANCE_UNARY(weakly_decrementable, WeaklyDecrementable, conformance::weakly_decrementable, iterators);
+CONFORMANCE_UNARY(decrementable, Decrementable, conformance::decrementable, iterators);
+CONFORMANCE_UNARY(readable, Readable, std::indirectly_readable, iterators);
+CONFORMANCE_UNARY(iterator, Iterator, std::input_or_output_iterator, iterators);
+CONFORMANCE_UNARY(input_iterator, InputIterator, std::input_iterator, iterators);
+CONFORMANCE_UNARY(forward_iterator, ForwardIterator, std::forward_iterator, iterators);
+CONFORMANCE_UNARY(bidirectional_iterator, BidirectionalIterator, std::bidirectional_iterator, iterators);
+CONFORMANCE_UNARY(random_access_iterator, RandomAccessIterator, std::random_access_iterator, iterators);
+CONFORMANCE_UNARY(iterator_values, Iterator, std::input_or_output_iterator, values);
+CONFORMANCE_UNARY(random_access_iterator_values, RandomAccessIterator, std::random_access_iterator, values);
+#if defined(__cpp_impl_coroutine)
+CONFORMANCE_UNARY(awaiter, conformance::ours_awaiter, conformance::awaiter, awaitables);
+CONFORMANCE_UNARY(awaitable, conformance::ours_awaitable, conformance::awaitable, awaitables);
+#endif
+
+CONFORMANCE_BINARY(convertible_to, ConvertibleTo, std::convertible_to, operands, operands);
+CONFORMANCE_BINARY(constructable_from, conformance::ours_constructable_from, conformance::std_constructible_from, operands, operands);
+CONFORMANCE_BINARY(assignable, Assignable, std::assignable_from, operands, operands);
+CONFORMANCE_BINARY(weakly_equality_comparable_with, WeaklyEqualityComparableWith, conformance::weakly_equality_comparable_with, operands, operands);
+CONFORMANCE_BINARY(equality_comparable_with, EqualityComparableWith, std::equality_comparable_with, operands, operands);
+CONFORMANCE_BINARY(partially_ordered_with, PartiallyOrderedWith, conformance::partially_ordered_with, operands, operands);
+CONFORMANCE_BINARY(derived_from, DerivedFrom, conformance::derived_from, operands, operands);
+CONFORMANCE_BINARY(is_base_of, IsBaseOf, std::is_base_of_v, operands, operands);
+CONFORMANCE_BINARY(sentinel, Sentinel, std::sentinel_for, sentinels, sentinels);
+CONFORMANCE_BINARY(sized_sentinel, SizedSentinel, std::sized_sentinel_for, sentinels, sentinels);
+CONFORMANCE_BINARY(writeable, Writeable, std::indirectly_writable, outputs, writables);
+
+CONFORMANCE_UNARY(detail_swappable, concepts::Swappable, std::is_swappable_v, values);
+CONFORMANCE_UNARY(detail_pointer, concepts::Pointer, std::is_pointer_v, values);
+CONFORMANCE_UNARY(detail_integral, concepts::Integral, std::is_integral_v, values);
+CONFORMANCE_UNARY(detail_floating_point, concepts::FloatingPoint, std::is_floating_point_v, values);
+CONFORMANCE_UNARY(detail_array, concepts::Array, std::is_array_v, values);
+CONFORMANCE_UNARY(detail_enum, concepts::Enum, std::is_enum_v, values);
+CONFORMANCE_UNARY(detail_class, concepts::Class, std::is_class_v, values);
+CONFORMANCE_UNARY(detail_function, concepts::Function, std::is_function_v, values);
+CONFORMANCE_UNARY(detail_union, concepts::Union, std::is_union_v, values);
+CONFORMANCE_UNARY(detail_void, concepts::Void, std::is_void_v, values);
+CONFORMANCE_UNARY(detail_fundamental, concepts::Fundamental, std::is_fundamental_v, values);
+CONFORMANCE_UNARY(detail_arithmetic, concepts::Arithmetic, std::is_arithmetic_v, values);
+CONFORMANCE_UNARY(detail_scalar, concepts::Scalar, std::is_scalar_v, values);
+CONFORMANCE_UNARY(detail_object, concepts::Object, std::is_object_v, values);
+CONFORMANCE_UNARY(detail_compound, concepts::Compound, std::is_compound_v, values);
+CONFORMANCE_UNARY(detail_lvalue_reference, concepts::LvalueReference, std::is_lvalue_reference_v, values);
+CONFORMANCE_UNARY(detail_rvalue_reference, concepts::RvalueReference, std::is_rvalue_reference_v, values);
+CONFORMANCE_UNARY(detail_member_pointer, concepts::MemberPointer, std::is_member_pointer_v, values);
+CONFORMANCE_UNARY(detail_member_object_pointer, concepts::MemberObjectPointer, std::is_member_object_pointer_v, values);
+CONFORMANCE_UNARY(detail_member_function_pointer, concepts::MemberFunctionPointer, std::is_member_function_pointer_v, values);
+CONFORMANCE_UNARY(detail_reference, concepts::Reference, std::is_reference_v, values);
+CONFORMANCE_UNARY(detail_const, concepts::Const, std::is_const_v, values);
+CONFORMANCE_UNARY(detail_volatile, concepts::Volatile, std::is_volatile_v, values);
+CONFORMANCE_UNARY(detail_trivial, concepts::Trivial, std::is_trivial_v, values);
+CONFORMANCE_UNARY(detail_trivially_copyable, concepts::TriviallyCopyable, std::is_trivially_copyable_v, values);
+CONFORMANCE_UNARY(detail_unique_object_representations, concepts::UniqueObjectRepresentations, std::has_unique_object_representations_v, values);
+CONFORMANCE_UNARY(detail_standard_layout, concepts::StandardLayout, std::is_standard_layout_v, values);
+CONFORMANCE_UNARY(detail_empty, concepts::Empty, std::is_empty_v, values);
+CONFORMANCE_UNARY(detail_polymorphic, concepts::Polymorphic, std::is_polymorphic_v, values);
+CONFORMANCE_UNARY(detail_abstract, concepts::Abstract, std::is_abstract_v, values);
+CONFORMANCE_UNARY(detail_final, concepts::Final, std::is_final_v, values);
+CONFORMANCE_UNARY(detail_aggregate, concepts::Aggregate, std::is_aggregate_v, values);
+CONFORMANCE_UNARY(detail_signed, concepts::Signed, std::is_signed_v, values);
+CONFORMANCE_UNARY(detail_unsigned, concepts::Unsigned, std::is_unsigned_v, values);
+CONFORMANCE_UNARY(detail_default_constructable, concepts::DefaultConstructable, std::is_default_constructible_v, values);
+CONFORMANCE_UNARY(detail_virtual_destructor, concepts::VirtualDestructor, std::has_virtual_destructor_v, values);
+CONFORMANCE_UNARY(detail_copy_constructable, concepts::CopyConstructable, std::is_copy_constructible_v, values);
+CONFORMANCE_UNARY(detail_move_constructable, concepts::MoveConstructable, std::is_move_constructible_v, values);
+CONFORMANCE_UNARY(detail_copy_assignable, concepts::CopyAssignable, conformance::copy_assignable, values);
+CONFORMANCE_UNARY(detail_move_assignable, concepts::MoveAssignable, conformance::move_assignable, values);
+CONFORMANCE_BINARY(detail_swappable_with, concepts::SwappableWith, std::is_swappable_with_v, operands, operands);
+CONFORMANCE_BINARY(detail_base_of, concepts::BaseOf, std::is_base_of_v, operands, operands);
+CONFORMANCE_BINARY(detail_is_base, concepts::IsBase, std::is_base_of_v, operands, operands);
+CONFORMANCE_BINARY(detail_convertible, concepts::Convertible, std::is_convertible_v, operands, operands);
+CONFORMANCE_BINARY(detail_assignable_from, concepts::AssignableFrom, std::is_assignable_v, operands, operands);
+CONFORMANCE_BINARY(detail_same, concepts::Same, std::same_as, operands, operands);
+CONFORMANCE_BINARY(detail_constructable, conformance::detail_constructable_from, conformance::std_is_constructible, operands, operands);
+CONFORMANCE_BINARY(detail_trivially_constructable, concepts::TriviallyConstructable, std::is_trivially_constructible_v, operands, operands);
+CONFORMANCE_BINARY(detail_nothrow_constructable, concepts::NothrowConstructable, std::is_nothrow_constructible_v, operands, operands);
+CONFORMANCE_UNARY(detail_callable, concepts::Callable, std::is_invocable_v, callables);
@@ -0,0 +1,77 @@
+// Checks for Task.hpp. Coroutines need C++20 (/std:c++latest, -std=c++20), so
+// these live apart from Concepts.cpp, which stays a C++17 translation unit.
+
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#if !defined(__cpp_impl_coroutine)
+#error "Coroutines.cpp checks Task.hpp and needs C++20 coroutines"
+#endif
+
+#include "Concepts/Task.hpp"
+
+static_assert(coro::Awaitable<coro::task<int>>, "");
+static_assert(coro::Awaitable<coro::task<void>>, "");
+static_assert(!coro::Awaitable<coro::task<int>&>, "");
+static_assert(coro::Awaiter<coro::task<int>::awaiter>, "");
+static_assert(coro::Awaiter<coro::task<int>::ready_awaiter>, "");
+static_assert(Moveable<coro::task<int>>, "");
+static_assert(!Copyable<coro::task<int>>, "");
+static_assert(coro::Executor<coro::single_thread_executor>, "");
+static_assert(coro::Executor<coro::thread_pool_executor>, "");
+static_assert(!coro::Executor<int>, "");
+static_assert(concepts::Same<decltype(coro::sync_wait(std::declval<coro::task<int>>())), int>, "");
+static_assert(concepts::Same<decltype(std::declval<coro::task<int>::awaiter&>().await_resume()), int>, "");
+
+coro::task<int> coroutines_answer()
+{
+  co_return 42;
+}
+
+coro::task<void> coroutines_chain(int &out)
+{
+  out = co_await coroutines_answer();
+}
+
+coro::task<std::thread::id> coroutines_hop(coro::thread_pool_executor &pool)
+{
+  co_await pool.schedule();
+  co_return std::this_thread::get_id();
+}
+
+coro::task<int> coroutines_fail()
+{
+  throw std::runtime_error("task failed");
+  co_return 0;
+}
+
+coro::task<int> coroutines_rethrow()
+{
+  co_return co_await coroutines_fail() + 1;
+}
+
+// Called from main in Concepts.cpp.
+bool coroutines_match()
+{
+  int out = 0;
+  coro::single_thread_executor executor;
+  coro::spawn(executor, coroutines_chain(out));
+  executor.run();
+
+  coro::thread_pool_executor pool(2);
+  const bool hopped = coro::sync_wait(coroutines_hop(pool)) != std::this_thread::get_id();
+
+  bool propagated = false;
+  try
+  {
+    coro::sync_wait(coroutines_rethrow());
+  }
+  catch (const std::runtime_error &)
+  {
+    propagated = true;
+  }
+
+  return out == 42 && coro::sync_wait(coroutines_answer()) == 42 && hopped && propagated;
+}
@@ -0,0 +1,212 @@
+#!/usr/bin/env python3
+"""Per-row compile time and peak memory for Conformance.cpp.
+
+Every CONFORMANCE_* line in Conformance.cpp is compiled on its own, after the
+shared prelude, with -fsyntax-only. A translation unit holding only the
+prelude is measured too, so each row also reports its cost over that baseline.
+
+    conformance_timing.py --out timings.csv
+    conformance_timing.py --baseline timings.csv
+
+With --baseline the script exits non-zero when any row got slower or larger
+than the recorded value by more than --tolerance (relative) and --slack
+(absolute seconds), or when a row fails to compile. Record baselines on the
+machine that checks them; the numbers do not transfer between hosts.
+
+Peak memory comes from wait4 on POSIX and from the process's peak working set
+on Windows; elsewhere it is reported as 0. With MSVC pass the compiler and
+flags explicitly, e.g. --cxx cl --flags "/std:c++latest /Zs /EHsc /nologo".
+"""
+
+import argparse
+import csv
+import os
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SOURCE = os.path.join(HERE, 'Conformance.cpp')
+ROWS_MARKER = '// rows'
+BASELINE_ROW = '(prelude)'
+
+
+def split_source(path):
+  """Returns the prelude and a list of (name, text) rows. Rows inside #if
+  blocks keep their enclosing conditionals."""
+  with open(path) as f:
+    lines = f.read().splitlines()
+
+  marker = next(i for i, line in enumerate(lines) if line.strip() == ROWS_MARKER)
+  prelude = '\n'.join(lines[:marker]) + '\n'
+
+  rows = []
+  conditions = []
+  for line in lines[marker + 1:]:
+    stripped = line.strip()
+    if stripped.startswith('#if'):
+      conditions.append(stripped)
+    elif stripped.startswith('#endif'):
+      conditions.pop()
+    elif stripped.startswith('CONFORMANCE_'):
+      name = stripped[stripped.index('(') + 1:stripped.index(',')].strip()
+      text = '\n'.join(conditions + [line] + ['#endif'] * len(conditions))
+      rows.append((name, text))
+  return prelude, rows
+
+
+def windows_peak_kib(pid):
+  """Peak working set in KiB of a process that has exited but whose handle is
+  still held by its Popen object, or 0 if it cannot be read."""
+  import ctypes
+  from ctypes import wintypes
+
+  class PROCESS_MEMORY_COUNTERS(ctypes.Structure):
+    _fields_ = [('cb', wintypes.DWORD), ('PageFaultCount', wintypes.DWORD)] + [
+      (name, ctypes.c_size_t) for name in (
+        'PeakWorkingSetSize', 'WorkingSetSize', 'QuotaPeakPagedPoolUsage', 'QuotaPagedPoolUsage',
+        'QuotaPeakNonPagedPoolUsage', 'QuotaNonPagedPoolUsage', 'PagefileUsage', 'PeakPagefileUsage')]
+
+  PROCESS_QUERY_LIMITED_INFORMATION = 0x1000
+  PROCESS_VM_READ = 0x0010
+  kernel32 = ctypes.WinDLL('kernel32', use_last_error=True)
+  kernel32.OpenProcess.restype = wintypes.HANDLE
+  handle = kernel32.OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION | PROCESS_VM_READ, False, pid)
+  if not handle:
+    return 0
+  try:
+    counters = PROCESS_MEMORY_COUNTERS()
+    counters.cb = ctypes.sizeof(counters)
+    if not kernel32.K32GetProcessMemoryInfo(handle, ctypes.byref(counters), counters.cb):
+      return 0
+    return counters.PeakWorkingSetSize // 1024
+  finally:
+    kernel32.CloseHandle(handle)
+
+
+def run_once(command):
+  """Wall time in seconds, exit code, peak memory in KiB and stderr of one run.
+  Diagnostics go to a file rather than a pipe: nothing reads a pipe while
+  wait4 blocks, so a failing row with a full pipe would never exit."""
+  with tempfile.TemporaryFile() as stderr:
+    start = time.perf_counter()
+    proc = subprocess.Popen(command, stdout=subprocess.DEVNULL, stderr=stderr)
+    if hasattr(os, 'wait4'):
+      _, status, usage = os.wait4(proc.pid, 0)
+      seconds = time.perf_counter() - start
+      proc.returncode = code = os.waitstatus_to_exitcode(status)
+      # ru_maxrss is in bytes on macOS and KiB elsewhere.
+      peak = usage.ru_maxrss // 1024 if sys.platform == 'darwin' else usage.ru_maxrss
+    else:
+      code = proc.wait()
+      seconds = time.perf_counter() - start
+      peak = windows_peak_kib(proc.pid) if sys.platform == 'win32' else 0
+    stderr.seek(0)
+    errors = stderr.read()
+  return seconds, code, peak, errors.decode(errors='replace')
+
+
+def measure(command, runs):
+  """Median wall time in seconds and peak memory in KiB."""
+  times = []
+  peak = 0
+  for _ in range(runs):
+    seconds, code, rss, errors = run_once(command)
+    if code != 0:
+      return None, None, errors
+    times.append(seconds)
+    peak = max(peak, rss)
+  return statistics.median(times), peak, ''
+
+
+def run(args):
+  prelude, rows = split_source(args.source)
+  if args.filter:
+    rows = [(name, text) for name, text in rows if args.filter in name]
+
+  include = os.path.dirname(os.path.abspath(args.source))
+  flags = args.flags.split() + ['-I', include]
+  results = []
+  failed = []
+
+  with tempfile.TemporaryDirectory() as scratch:
+    tu = os.path.join(scratch, 'row.cpp')
+    with open(tu, 'w') as f:
+      f.write(prelude)
+    # Untimed, so the first measurement does not pay for a cold disk cache.
+    subprocess.run([args.cxx] + flags + [tu], stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+
+    for name, text in [(BASELINE_ROW, '')] + rows:
+      with open(tu, 'w') as f:
+        f.write(prelude + text + '\n')
+
+      seconds, rss, errors = measure([args.cxx] + flags + [tu], args.runs)
+      if seconds is None:
+        failed.append(name)
+        sys.stderr.write('%s: does not compile\n%s\n' % (name, errors))
+        continue
+
+      results.append({ 'row': name, 'seconds': seconds, 'max_rss_kb': rss })
+      print('%-40s %8.3f s %10d KiB' % (name, seconds, rss), flush=True)
+
+  base = next((r for r in results if r['row'] == BASELINE_ROW), None)
+  for r in results:
+    r['delta_seconds'] = r['seconds'] - base['seconds'] if base else 0.0
+    r['delta_rss_kb'] = r['max_rss_kb'] - base['max_rss_kb'] if base else 0
+  return results, failed
+
+
+def write_csv(path, results):
+  fields = ['row', 'seconds', 'delta_seconds', 'max_rss_kb', 'delta_rss_kb']
+  with open(path, 'w', newline='') as f:
+    writer = csv.DictWriter(f, fieldnames=fields)
+    writer.writeheader()
+    for r in results:
+      writer.writerow({ k: ('%.4f' % r[k] if isinstance(r[k], float) else r[k]) for k in fields })
+
+
+def regressions(results, baseline_path, tolerance, slack):
+  with open(baseline_path, newline='') as f:
+    baseline = { r['row']: r for r in csv.DictReader(f) }
+
+  found = []
+  for r in results:
+    old = baseline.get(r['row'])
+    if old is None:
+      continue
+    old_seconds = float(old['seconds'])
+    old_rss = int(old['max_rss_kb'])
+    if r['seconds'] > old_seconds * (1 + tolerance) + slack:
+      found.append('%s: %.3f s, was %.3f s' % (r['row'], r['seconds'], old_seconds))
+    if r['max_rss_kb'] > old_rss * (1 + tolerance):
+      found.append('%s: %d KiB, was %d KiB' % (r['row'], r['max_rss_kb'], old_rss))
+  return found
+
+
+def main():
+  parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+  parser.add_argument('--source', default=SOURCE)
+  parser.add_argument('--cxx', default=os.environ.get('CXX', 'g++'))
+  parser.add_argument('--flags', default='-std=c++20 -fsyntax-only')
+  parser.add_argument('--runs', type=int, default=3)
+  parser.add_argument('--filter', help='only rows whose name contains this')
+  parser.add_argument('--out', help='write the timings as CSV')
+  parser.add_argument('--baseline', help='CSV from an earlier run to gate against')
+  parser.add_argument('--tolerance', type=float, default=0.25)
+  parser.add_argument('--slack', type=float, default=0.05)
+  args = parser.parse_args()
+
+  results, failed = run(args)
+  if args.out:
+    write_csv(args.out, results)
+
+  found = regressions(results, args.baseline, args.tolerance, args.slack) if args.baseline else []
+  for line in found:
+    sys.stderr.write('regression: %s\n' % line)
+  return 1 if failed or found else 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())